@@ -29,6 +29,14 @@
 *
 *   NOTE: Code generated requires raygui 3.5-dev
 *
+*   ASYNC GENERATION:
+*       GenLayoutCodeAsync() generates code on a worker thread from an immutable snapshot of the
+*       layout, config and template, so the caller can keep editing them. Requesting a new job
+*       cancels any stale one, only the latest requested result is returned by GetLayoutCodeAsync()
+*
+*   NOTE: Code generation is not reentrant (it uses module text buffers), only one
+*   generation can run at a time, do not call GenLayoutCode() while an async job is running
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2018-2022 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
@@ -55,6 +63,12 @@
 #ifndef CODEGEN_H
 #define CODEGEN_H
 
+// Code generation on worker thread support
+// NOTE: Not available on PLATFORM_WEB and MSVC (no pthreads), async jobs run synchronously
+#if !defined(PLATFORM_WEB) && !defined(_MSC_VER)
+    #define CODEGEN_SUPPORT_THREADS
+#endif
+
 #ifdef __cplusplus
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -64,6 +78,10 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vector2 offset, GuiLayoutConfig config);
 
+void GenLayoutCodeAsync(const unsigned char *buffer, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config); // Request layout code generation (cancels stale jobs)
+bool GetLayoutCodeAsync(unsigned char **code, bool wait);   // Get latest requested layout code if ready (ownership is transferred)
+void CloseLayoutCodeAsync(void);                            // Cancel jobs and close worker thread
+
 #ifdef __cplusplus
 }
 #endif
@@ -77,13 +95,51 @@ unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vec
 ************************************************************************************/
 #if defined(CODEGEN_IMPLEMENTATION)
 
+#if defined(CODEGEN_SUPPORT_THREADS)
+    #include <pthread.h>            // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()...
+#endif
+
+#include <stdio.h>                  // Required for: vsnprintf()
+#include <stdarg.h>                 // Required for: va_list, va_start(), va_end()
+#include <string.h>                 // Required for: strcpy(), strlen(), memcpy()
+#include <ctype.h>                  // Required for: toupper(), tolower()
+
 #define TABAPPEND(x, y, z)          { for (int t = 0; t < z; t++) TextAppend(x, "    ", y); }
 #define ENDLINEAPPEND(x, y)         TextAppend(x, "\n", y);
 
+#define CODE_TEXT_BUFFER_LENGTH     1024        // Code text functions buffer size
+#define CODE_TEXT_BUFFERS_COUNT        4        // Code text format rotating buffers
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Code generation job, owns a snapshot of all generation inputs
+typedef struct {
+    unsigned int id;                // Job id, job is stale if a newer job has been requested
+    unsigned char *buffer;          // Code template text copy
+    GuiLayout *layout;              // Layout snapshot (anchor pointers remapped to snapshot)
+    Vector2 offset;                 // Code generation offset
+    GuiLayoutConfig config;         // Code generation config
+} CodegenJob;
+
 //----------------------------------------------------------------------------------
 // Global variables definition
 //----------------------------------------------------------------------------------
-//...
+static CodegenJob *pendingJob = NULL;       // Next job to be processed, replaced by newer requests
+static unsigned int requestedJobId = 0;     // Latest requested job id
+static unsigned int completedJobId = 0;     // Latest completed (or discarded) job id
+static unsigned char *resultCode = NULL;    // Latest job result code, waiting to be retrieved
+static bool resultReady = false;            // Latest job result ready to be retrieved
+
+#if defined(CODEGEN_SUPPORT_THREADS)
+static pthread_t workerThread;
+static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobRequestedCond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t jobCompletedCond = PTHREAD_COND_INITIALIZER;
+static bool workerActive = false;
+static bool workerClose = false;
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -109,6 +165,20 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 static void WriteControlsDrawing(unsigned char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, const char *preText, int tabs);
 static void WriteControlDraw(unsigned char *toolstr, int *pos, int index, GuiLayoutControl control, GuiLayoutConfig config, const char *preText);
 
+// Async code generation functions
+static unsigned char *GenLayoutCodeJob(const unsigned char *buffer, GuiLayout *layout, Vector2 offset, GuiLayoutConfig config, unsigned int jobId);
+static bool IsCodegenJobStale(unsigned int jobId);  // Check if a newer job has been requested
+static void UnloadCodegenJob(CodegenJob *job);      // Unload job snapshot data
+#if defined(CODEGEN_SUPPORT_THREADS)
+static void *CodegenWorker(void *arg);              // Worker thread, processes pending jobs
+#endif
+
+// Reentrant text functions, raylib ones use internal buffers shared with caller thread
+static const char *CodeTextFormat(const char *text, ...);
+static const char *CodeTextToUpper(const char *text);
+static const char *CodeTextToLower(const char *text);
+static const char *CodeTextToPascal(const char *text);
+
 // Get controls specific texts functions
 static char *GetControlRectangleText(int index, GuiLayoutControl control, bool defineRecs, bool exportAnchors,  const char *preText);
 static char *GetScrollPanelContainerRecText(int index, GuiLayoutControl control, bool defineRecs, bool exportAnchors, const char *preText);
@@ -123,6 +193,192 @@ static int  *GetControlValuesParam(GuiLayoutControl control);
 // Generate layout code string
 // TODO: WARNING: layout is passed as value, probably not a good idea considering the size of the object
 unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vector2 offset, GuiLayoutConfig config)
+{
+    return GenLayoutCodeJob(buffer, layout, offset, config, 0);
+}
+
+// Request layout code generation
+// NOTE: Inputs are copied into a job snapshot, a previous job not yet started is discarded
+// and a running one is cancelled (it will check it is stale and stop)
+void GenLayoutCodeAsync(const unsigned char *buffer, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config)
+{
+    CodegenJob *job = (CodegenJob *)RL_CALLOC(1, sizeof(CodegenJob));
+
+    if (buffer != NULL)
+    {
+        int bufferLen = (int)strlen(buffer);
+        job->buffer = (unsigned char *)RL_MALLOC(bufferLen + 1);
+        memcpy(job->buffer, buffer, bufferLen + 1);
+    }
+
+    // Copy layout, controls anchors must point to the snapshot anchors
+    // NOTE: Anchor id is the anchor index in the layout anchors array
+    job->layout = (GuiLayout *)RL_MALLOC(sizeof(GuiLayout));
+    memcpy(job->layout, layout, sizeof(GuiLayout));
+    for (int i = 0; i < layout->controlCount; i++) job->layout->controls[i].ap = &job->layout->anchors[layout->controls[i].ap->id];
+
+    job->offset = offset;
+    job->config = config;
+    job->config.template = job->buffer;
+
+#if defined(CODEGEN_SUPPORT_THREADS)
+    pthread_mutex_lock(&jobMutex);
+
+    job->id = ++requestedJobId;
+    if (pendingJob != NULL) UnloadCodegenJob(pendingJob);
+    pendingJob = job;
+
+    if (!workerActive)
+    {
+        workerClose = false;
+        if (pthread_create(&workerThread, NULL, CodegenWorker, NULL) == 0) workerActive = true;
+    }
+
+    if (workerActive)
+    {
+        pthread_cond_signal(&jobRequestedCond);
+        pthread_mutex_unlock(&jobMutex);
+        return;
+    }
+
+    // Worker thread could not be created, process job synchronously
+    pendingJob = NULL;
+    pthread_mutex_unlock(&jobMutex);
+    TraceLog(LOG_WARNING, "CODEGEN: Worker thread could not be created, generating code synchronously");
+#else
+    job->id = ++requestedJobId;
+#endif
+
+    RL_FREE(resultCode);
+    resultCode = GenLayoutCodeJob(job->buffer, job->layout, job->offset, job->config, 0);
+    resultReady = true;
+    completedJobId = job->id;
+    UnloadCodegenJob(job);
+}
+
+// Get latest requested layout code if ready
+// NOTE: Returned code ownership is transferred to caller, wait flag blocks until latest job is completed
+bool GetLayoutCodeAsync(unsigned char **code, bool wait)
+{
+    bool ready = false;
+
+#if defined(CODEGEN_SUPPORT_THREADS)
+    pthread_mutex_lock(&jobMutex);
+    if (wait && workerActive) while (completedJobId != requestedJobId) pthread_cond_wait(&jobCompletedCond, &jobMutex);
+#endif
+
+    if (resultReady)
+    {
+        *code = resultCode;
+        resultCode = NULL;
+        resultReady = false;
+        ready = true;
+    }
+
+#if defined(CODEGEN_SUPPORT_THREADS)
+    pthread_mutex_unlock(&jobMutex);
+#endif
+
+    return ready;
+}
+
+// Cancel jobs and close worker thread
+void CloseLayoutCodeAsync(void)
+{
+#if defined(CODEGEN_SUPPORT_THREADS)
+    pthread_mutex_lock(&jobMutex);
+    bool joinWorker = workerActive;
+    workerClose = true;
+    requestedJobId++;       // Running job is stale now
+    pthread_cond_signal(&jobRequestedCond);
+    pthread_mutex_unlock(&jobMutex);
+
+    if (joinWorker) pthread_join(workerThread, NULL);
+    workerActive = false;
+#endif
+
+    if (pendingJob != NULL) UnloadCodegenJob(pendingJob);
+    pendingJob = NULL;
+
+    RL_FREE(resultCode);
+    resultCode = NULL;
+    resultReady = false;
+    completedJobId = requestedJobId;
+}
+
+//----------------------------------------------------------------------------------
+// Async code generation functions
+//----------------------------------------------------------------------------------
+
+// Check if a newer job has been requested
+static bool IsCodegenJobStale(unsigned int jobId)
+{
+    bool stale = false;
+
+#if defined(CODEGEN_SUPPORT_THREADS)
+    pthread_mutex_lock(&jobMutex);
+    stale = (jobId != requestedJobId);
+    pthread_mutex_unlock(&jobMutex);
+#endif
+
+    return stale;
+}
+
+// Unload job snapshot data
+static void UnloadCodegenJob(CodegenJob *job)
+{
+    RL_FREE(job->buffer);
+    RL_FREE(job->layout);
+    RL_FREE(job);
+}
+
+#if defined(CODEGEN_SUPPORT_THREADS)
+// Worker thread, processes pending jobs until close is requested
+static void *CodegenWorker(void *arg)
+{
+    pthread_mutex_lock(&jobMutex);
+
+    while (!workerClose)
+    {
+        if (pendingJob == NULL)
+        {
+            pthread_cond_wait(&jobRequestedCond, &jobMutex);
+            continue;
+        }
+
+        CodegenJob *job = pendingJob;
+        pendingJob = NULL;
+        pthread_mutex_unlock(&jobMutex);
+
+        unsigned char *code = GenLayoutCodeJob(job->buffer, job->layout, job->offset, job->config, job->id);
+
+        pthread_mutex_lock(&jobMutex);
+
+        if (job->id == requestedJobId)
+        {
+            // Swap in latest result, previous one not retrieved is discarded
+            RL_FREE(resultCode);
+            resultCode = code;
+            resultReady = true;
+        }
+        else RL_FREE(code);     // Stale job result
+
+        // NOTE: Stale jobs also complete, newer pending job will be processed next
+        if (pendingJob == NULL) completedJobId = requestedJobId;
+        pthread_cond_broadcast(&jobCompletedCond);
+
+        UnloadCodegenJob(job);
+    }
+
+    pthread_mutex_unlock(&jobMutex);
+
+    return NULL;
+}
+#endif
+
+// Generate layout code string, checking for job cancellation
+// NOTE: jobId 0 means the generation can not be cancelled (synchronous generation)
+static unsigned char *GenLayoutCodeJob(const unsigned char *buffer, GuiLayout *layout, Vector2 offset, GuiLayoutConfig config, unsigned int jobId)
 {
     #define MAX_CODE_SIZE            1024*1024       // Max code size: 1MB
     #define MAX_VARIABLE_NAME_SIZE     64
@@ -130,7 +386,7 @@ unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vec
     if (buffer == NULL) return NULL;
 
     unsigned char *toolstr = (unsigned char *)RL_CALLOC(MAX_CODE_SIZE, sizeof(unsigned char));
-    unsigned const char *substr = NULL;
+    char substr[MAX_VARIABLE_NAME_SIZE + 1] = { 0 };
 
     int bufferPos = 0;
     int codePos = 0;
@@ -162,6 +418,14 @@ unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vec
     {
         if ((buffer[i] == '$') && (buffer[i + 1] == '('))       // Detect variable to be replaced!
         {
+            // Stop generation if a newer job has been requested
+            if ((jobId != 0) && IsCodegenJobStale(jobId))
+            {
+                RL_FREE(toolstr);
+                toolstr = NULL;
+                break;
+            }
+
             int spaceWidth = 0;
             for (int j = i-1; j >= 0; j--)
             {
@@ -174,10 +438,10 @@ unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vec
             }
             int tabs = (int)spaceWidth/4;
 
-            substr = TextSubtext(buffer, bufferPos, i - bufferPos);
-
-            strcpy(toolstr + codePos, substr);
-            codePos = (int)strlen(toolstr);
+            // NOTE: Template text is copied directly, TextSubtext() uses a shared buffer (and limits length)
+            memcpy(toolstr + codePos, buffer + bufferPos, i - bufferPos);
+            codePos += (i - bufferPos);
+            toolstr[codePos] = '\0';
 
             i += 2;
             bufferPos = i;
@@ -186,24 +450,25 @@ unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vec
             {
                 if (buffer[i + j] == ')')
                 {
-                    substr = TextSubtext(buffer, i, j);
+                    memcpy(substr, buffer + i, j);
+                    substr[j] = '\0';
 
                     if (TextIsEqual(substr, "GUILAYOUT_NAME")) TextAppend(toolstr, config.name, &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_UPPERCASE")) TextAppend(toolstr, TextToUpper(config.name), &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_LOWERCASE")) TextAppend(toolstr, TextToLower(config.name), &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_PASCALCASE")) TextAppend(toolstr, TextToPascal(config.name), &codePos);
+                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_UPPERCASE")) TextAppend(toolstr, CodeTextToUpper(config.name), &codePos);
+                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_LOWERCASE")) TextAppend(toolstr, CodeTextToLower(config.name), &codePos);
+                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_PASCALCASE")) TextAppend(toolstr, CodeTextToPascal(config.name), &codePos);
                     else if (TextIsEqual(substr, "GUILAYOUT_VERSION")) TextAppend(toolstr, config.version, &codePos);
                     else if (TextIsEqual(substr, "GUILAYOUT_DESCRIPTION")) TextAppend(toolstr, config.description, &codePos);
                     else if (TextIsEqual(substr, "GUILAYOUT_COMPANY")) TextAppend(toolstr, config.company, &codePos);
                     else if (TextIsEqual(substr, "GUILAYOUT_WINDOW_WIDTH"))
                     {
-                       if (layout->refWindow.width > 0) TextAppend(toolstr, TextFormat("%i", (int)layout->refWindow.width), &codePos);
-                       else TextAppend(toolstr, TextFormat("%i", 800), &codePos);
+                       if (layout->refWindow.width > 0) TextAppend(toolstr, CodeTextFormat("%i", (int)layout->refWindow.width), &codePos);
+                       else TextAppend(toolstr, CodeTextFormat("%i", 800), &codePos);
                     }
                     else if (TextIsEqual(substr, "GUILAYOUT_WINDOW_HEIGHT"))
                     {
-                       if (layout->refWindow.height > 0) TextAppend(toolstr, TextFormat("%i", (int)layout->refWindow.height), &codePos);
-                       else TextAppend(toolstr, TextFormat("%i", 450), &codePos);
+                       if (layout->refWindow.height > 0) TextAppend(toolstr, CodeTextFormat("%i", (int)layout->refWindow.height), &codePos);
+                       else TextAppend(toolstr, CodeTextFormat("%i", 450), &codePos);
                     }
 
                     // C IMPLEMENTATION
@@ -227,7 +492,7 @@ unsigned char *GenLayoutCode(const unsigned char *buffer, GuiLayout *layout, Vec
     }
 
     // Copy remaining text into toolstr
-    strcpy(toolstr + codePos, buffer + bufferPos);
+    if (toolstr != NULL) strcpy(toolstr + codePos, buffer + bufferPos);
 
     // In case of controls with no anchor, offset must be applied to control position
     for (int i = 0; i < layout->controlCount; i++)
@@ -269,11 +534,11 @@ static void WriteFunctionsDeclarationC(unsigned char *toolstr, int *pos, GuiLayo
             if (type == GUI_BUTTON || type == GUI_LABELBUTTON)
             {
                 buttonsCount++;
-                TextAppend(toolstr, TextFormat("static void %s();", TextToPascal(layout->controls[i].name)), pos);
+                TextAppend(toolstr, CodeTextFormat("static void %s();", CodeTextToPascal(layout->controls[i].name)), pos);
                 if (config.fullComments)
                 {
                     TABAPPEND(toolstr, pos, 4);
-                    TextAppend(toolstr, TextFormat("// %s: %s logic", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
+                    TextAppend(toolstr, CodeTextFormat("// %s: %s logic", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
                 }
                 ENDLINEAPPEND(toolstr, pos);
                 TABAPPEND(toolstr, pos, tabs);
@@ -309,7 +574,7 @@ static void WriteInitializationC(unsigned char *toolstr, int *pos, GuiLayout *la
             ENDLINEAPPEND(toolstr, pos);
             TABAPPEND(toolstr, pos, tabs);
         }
-        TextAppend(toolstr, TextFormat("Rectangle layoutRecs[%i] = {", layout->controlCount), pos);
+        TextAppend(toolstr, CodeTextFormat("Rectangle layoutRecs[%i] = {", layout->controlCount), pos);
         ENDLINEAPPEND(toolstr, pos);
 
         for (int k = 0; k < layout->controlCount; k++)
@@ -341,12 +606,12 @@ static void WriteFunctionsDefinitionC(unsigned char *toolstr, int *pos, GuiLayou
             {
                 if (config.fullComments)
                 {
-                    TextAppend(toolstr, TextFormat("// %s: %s logic", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
+                    TextAppend(toolstr, CodeTextFormat("// %s: %s logic", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
                     ENDLINEAPPEND(toolstr, pos);
                     TABAPPEND(toolstr, pos, tabs);
                 }
 
-                TextAppend(toolstr, TextFormat("static void %s()", TextToPascal(layout->controls[i].name)), pos);
+                TextAppend(toolstr, CodeTextFormat("static void %s()", CodeTextToPascal(layout->controls[i].name)), pos);
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
                 TextAppend(toolstr, "{", pos);
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
@@ -388,7 +653,7 @@ static void WriteStruct(unsigned char *toolstr, int *pos, GuiLayout *layout, Gui
             ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
         }
 
-        TextAppend(toolstr, TextFormat("Rectangle layoutRecs[%i];", layout->controlCount), pos);
+        TextAppend(toolstr, CodeTextFormat("Rectangle layoutRecs[%i];", layout->controlCount), pos);
     }
 
     ENDLINEAPPEND(toolstr, pos); ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
@@ -397,15 +662,15 @@ static void WriteStruct(unsigned char *toolstr, int *pos, GuiLayout *layout, Gui
     TextAppend(toolstr, "// NOTE: This variables should be added manually if required", pos);
 
     ENDLINEAPPEND(toolstr, pos); ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-    TextAppend(toolstr, TextFormat("} Gui%sState;", TextToPascal(config.name)), pos);
+    TextAppend(toolstr, CodeTextFormat("} Gui%sState;", CodeTextToPascal(config.name)), pos);
 }
 
 // Write variables declaration code (.h)
 static void WriteFunctionsDeclarationH(unsigned char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
 {
-    TextAppend(toolstr, TextFormat("Gui%sState InitGui%s(void);", TextToPascal(config.name), TextToPascal(config.name)), pos);
+    TextAppend(toolstr, CodeTextFormat("Gui%sState InitGui%s(void);", CodeTextToPascal(config.name), CodeTextToPascal(config.name)), pos);
     ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-    TextAppend(toolstr, TextFormat("void Gui%s(Gui%sState *state);", TextToPascal(config.name), TextToPascal(config.name)), pos);    
+    TextAppend(toolstr, CodeTextFormat("void Gui%s(Gui%sState *state);", CodeTextToPascal(config.name), CodeTextToPascal(config.name)), pos);    
 
     // Generate buttons functions declaration
     if(config.exportButtonFunctions)
@@ -419,12 +684,12 @@ static void WriteFunctionsDeclarationH(unsigned char *toolstr, int *pos, GuiLayo
 static void WriteFunctionInitializeH(unsigned char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
 {
      // Export InitGuiLayout function definition
-    TextAppend(toolstr, TextFormat("Gui%sState InitGui%s(void)", TextToPascal(config.name), TextToPascal(config.name)), pos);
+    TextAppend(toolstr, CodeTextFormat("Gui%sState InitGui%s(void)", CodeTextToPascal(config.name), CodeTextToPascal(config.name)), pos);
     ENDLINEAPPEND(toolstr, pos);
     TextAppend(toolstr, "{", pos);
     ENDLINEAPPEND(toolstr, pos);
     TABAPPEND(toolstr, pos, tabs + 1);
-    TextAppend(toolstr, TextFormat("Gui%sState state = { 0 };", TextToPascal(config.name)), pos);
+    TextAppend(toolstr, CodeTextFormat("Gui%sState state = { 0 };", CodeTextToPascal(config.name)), pos);
     ENDLINEAPPEND(toolstr, pos);
     ENDLINEAPPEND(toolstr, pos);
     TABAPPEND(toolstr, pos, tabs + 1);
@@ -455,7 +720,7 @@ static void WriteFunctionInitializeH(unsigned char *toolstr, int *pos, GuiLayout
 
         for (int k = 0; k < layout->controlCount; k++)
         {
-            TextAppend(toolstr, TextFormat("state.layoutRecs[%i] = ", k), pos);
+            TextAppend(toolstr, CodeTextFormat("state.layoutRecs[%i] = ", k), pos);
             WriteRectangleVariables(toolstr, pos, layout->controls[k], config.exportAnchors, config.fullComments, "state.", tabs, true);
             ENDLINEAPPEND(toolstr, pos);
             TABAPPEND(toolstr, pos, tabs + 1);
@@ -487,7 +752,7 @@ static void WriteFunctionInitializeH(unsigned char *toolstr, int *pos, GuiLayout
 static void WriteFunctionDrawingH(unsigned char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
 {
     // Export GuiLayout draw function
-    TextAppend(toolstr, TextFormat("void Gui%s(Gui%sState *state)", TextToPascal(config.name), TextToPascal(config.name)), pos);
+    TextAppend(toolstr, CodeTextFormat("void Gui%s(Gui%sState *state)", CodeTextToPascal(config.name), CodeTextToPascal(config.name)), pos);
     ENDLINEAPPEND(toolstr, pos);
     TextAppend(toolstr, "{", pos);
     ENDLINEAPPEND(toolstr, pos);
@@ -512,12 +777,12 @@ static void WriteRectangleVariables(unsigned char *toolstr, int *pos, GuiLayoutC
 {
     if (exportAnchors && control.ap->id > 0)
     {
-        TextAppend(toolstr, TextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i, %i }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height), pos);
+        TextAppend(toolstr, CodeTextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i, %i }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height), pos);
     }
     else
     {
-        if (control.ap->id > 0) TextAppend(toolstr, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, (int)control.rec.height), pos);
-        else TextAppend(toolstr, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, (int)control.rec.height), pos);
+        if (control.ap->id > 0) TextAppend(toolstr, CodeTextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, (int)control.rec.height), pos);
+        else TextAppend(toolstr, CodeTextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, (int)control.rec.height), pos);
     }
 
     if (exportH) TextAppend(toolstr, ";", pos);
@@ -526,7 +791,7 @@ static void WriteRectangleVariables(unsigned char *toolstr, int *pos, GuiLayoutC
     if (fullComments)
     {
         TABAPPEND(toolstr, pos, tabs);
-        TextAppend(toolstr, TextFormat("// %s: %s",controlTypeName[control.type], control.name), pos);
+        TextAppend(toolstr, CodeTextFormat("// %s: %s",controlTypeName[control.type], control.name), pos);
     }
 }
 
@@ -548,20 +813,20 @@ static void WriteAnchors(unsigned char *toolstr, int *pos, GuiLayout *layout, Gu
         if (anchor.enabled)
         {
             if (define) TextAppend(toolstr, "Vector2 ", pos);
-            else TextAppend(toolstr, TextFormat("%s", preText), pos);
-            TextAppend(toolstr, TextFormat("%s", anchor.name), pos);
+            else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+            TextAppend(toolstr, CodeTextFormat("%s", anchor.name), pos);
             if (initialize)
             {
                 TextAppend(toolstr, " = ", pos);
                 if(!define) TextAppend(toolstr, "(Vector2)", pos);
-                TextAppend(toolstr, TextFormat("{ %i, %i }", (int)layout->anchors[i].x, (int)layout->anchors[i].y), pos);
+                TextAppend(toolstr, CodeTextFormat("{ %i, %i }", (int)layout->anchors[i].x, (int)layout->anchors[i].y), pos);
             }
             TextAppend(toolstr, ";", pos);
 
             if (config.fullComments)
             {
                 TABAPPEND(toolstr, pos, 3);
-                TextAppend(toolstr, TextFormat("// ANCHOR ID:%i", anchor.id), pos);
+                TextAppend(toolstr, CodeTextFormat("// ANCHOR ID:%i", anchor.id), pos);
             }
 
             ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
@@ -604,11 +869,11 @@ static void WriteConstText(unsigned char *toolstr, int *pos, GuiLayout *layout,
             case GUI_DUMMYREC:
             case GUI_STATUSBAR:
             {
-                TextAppend(toolstr, TextFormat("const char *%sText = \"%s\";", layout->controls[i].name, layout->controls[i].text), pos);
+                TextAppend(toolstr, CodeTextFormat("const char *%sText = \"%s\";", layout->controls[i].name, layout->controls[i].text), pos);
                 if (config.fullComments)
                 {
                     TABAPPEND(toolstr, pos, 1);
-                    TextAppend(toolstr, TextFormat("// %s: %s", TextToUpper(controlTypeName[layout->controls[i].type]), layout->controls[i].name), pos);
+                    TextAppend(toolstr, CodeTextFormat("// %s: %s", CodeTextToUpper(controlTypeName[layout->controls[i].type]), layout->controls[i].name), pos);
                 }
                 ENDLINEAPPEND(toolstr, pos);
                 TABAPPEND(toolstr, pos, tabs);
@@ -642,8 +907,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             case GUI_WINDOWBOX:
             {
                 if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sActive", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = true", pos);
                 TextAppend(toolstr, ";", pos);
 
@@ -653,10 +918,10 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             } break;
@@ -666,8 +931,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
                 if(!config.exportButtonFunctions)
                 {
                     if (define) TextAppend(toolstr, "bool ", pos);
-                    else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                    TextAppend(toolstr, TextFormat("%sPressed", control.name), pos);
+                    else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                    TextAppend(toolstr, CodeTextFormat("%sPressed", control.name), pos);
                     if (initialize) TextAppend(toolstr, " = false", pos);
                     TextAppend(toolstr, ";", pos);
 
@@ -677,10 +942,10 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                         if (define)
                         {
-                            TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                            if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                            TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                            if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                         }
-                        else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                        else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                         TextAppend(toolstr, ";", pos);
                     }
                 }
@@ -689,8 +954,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             case GUI_CHECKBOX:
             {
                 if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sChecked", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sChecked", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = false", pos);
                 TextAppend(toolstr, ";", pos);
 
@@ -700,18 +965,18 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             } break;
             case GUI_TOGGLE:
             {
                 if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sActive", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = true", pos);
                 TextAppend(toolstr, ";", pos);
 
@@ -721,10 +986,10 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             } break;
@@ -732,8 +997,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             case GUI_COMBOBOX:
             {
                 if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sActive", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = 0", pos);
                 TextAppend(toolstr, ";", pos);
 
@@ -743,25 +1008,25 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             } break;
             case GUI_LISTVIEW:
             {
                 if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sScrollIndex", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sScrollIndex", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = 0", pos);
                 TextAppend(toolstr, ";", pos);
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
                 
                 if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sActive", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = 0", pos);
                 TextAppend(toolstr, ";", pos);
 
@@ -771,25 +1036,25 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             } break;
             case GUI_DROPDOWNBOX:
             {
                 if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sEditMode", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sEditMode", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = false", pos);
                 TextAppend(toolstr, ";", pos);
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
 
                 if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sActive", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = 0", pos);
                 TextAppend(toolstr, ";", pos);
 
@@ -799,10 +1064,10 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             } break;
@@ -810,18 +1075,18 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             case GUI_TEXTBOXMULTI:
             {
                 if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sEditMode", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sEditMode", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = false", pos);
                 TextAppend(toolstr, ";", pos);
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
 
                 if (define)
                 {
-                    TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                    if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                    TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                    if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                 }
-                else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                 TextAppend(toolstr, ";", pos);
 
             } break;
@@ -829,15 +1094,15 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             case GUI_SPINNER:
             {
                 if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sEditMode", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sEditMode", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = false", pos);
                 TextAppend(toolstr, ";", pos);
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
 
                 if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sValue", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sValue", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = 0", pos);
                 TextAppend(toolstr, ";", pos);
 
@@ -847,8 +1112,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             case GUI_PROGRESSBAR:
             {
                 if (define) TextAppend(toolstr, "float ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sValue", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sValue", control.name), pos);
                 if (initialize) TextAppend(toolstr, " = 0.0f", pos);
                 TextAppend(toolstr, ";", pos);
                 
@@ -858,18 +1123,18 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
 
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             } break;
             case GUI_COLORPICKER:
             {
                 if (define) TextAppend(toolstr, "Color ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sValue", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sValue", control.name), pos);
                 if (initialize)
                 {
                     TextAppend(toolstr, " = ", pos);
@@ -881,8 +1146,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             case GUI_SCROLLPANEL:
             {
                 if (define) TextAppend(toolstr, "Rectangle ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sScrollView", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sScrollView", control.name), pos);
                 if (initialize)
                 {
                     TextAppend(toolstr, " = ", pos);
@@ -893,8 +1158,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
 
                 if (define) TextAppend(toolstr, "Vector2 ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sScrollOffset", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sScrollOffset", control.name), pos);
                 if (initialize)
                 {
                     TextAppend(toolstr, " = ", pos);
@@ -905,8 +1170,8 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
 
                 if (define) TextAppend(toolstr, "Vector2 ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sBoundsOffset", control.name), pos);
+                else TextAppend(toolstr, CodeTextFormat("%s", preText), pos);
+                TextAppend(toolstr, CodeTextFormat("%sBoundsOffset", control.name), pos);
                 if (initialize)
                 {
                     TextAppend(toolstr, " = ", pos);
@@ -924,10 +1189,10 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
                 {
                     if (define)
                     {
-                        TextAppend(toolstr, TextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
-                        if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                        TextAppend(toolstr, CodeTextFormat("char %sText[%s]", control.name, MAX_CONTROL_TEXT_LENGTH_TEXT), pos);
+                        if (initialize) TextAppend(toolstr, CodeTextFormat(" = \"%s\"", control.text), pos);
                     }
-                    else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
+                    else if (initialize) TextAppend(toolstr, CodeTextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
                     TextAppend(toolstr, ";", pos);
                 }
             }break;
@@ -945,7 +1210,7 @@ static void WriteControlsVariables(unsigned char *toolstr, int *pos, GuiLayout *
             if (config.fullComments)
             {
                 TABAPPEND(toolstr, pos, 3);
-                TextAppend(toolstr, TextFormat("// %s: %s", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
+                TextAppend(toolstr, CodeTextFormat("// %s: %s", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
             }
             ENDLINEAPPEND(toolstr, pos);
             TABAPPEND(toolstr, pos, tabs);
@@ -981,7 +1246,7 @@ static void WriteControlsDrawing(unsigned char *toolstr, int *pos, GuiLayout *la
             {
                 TextAppend(toolstr, " || ", pos);
             }
-            TextAppend(toolstr, TextFormat("%sEditMode", GetControlNameParam(layout->controls[i].name, preText)), pos);
+            TextAppend(toolstr, CodeTextFormat("%sEditMode", GetControlNameParam(layout->controls[i].name, preText)), pos);
         }
     }
 
@@ -1002,7 +1267,7 @@ static void WriteControlsDrawing(unsigned char *toolstr, int *pos, GuiLayout *la
 
                 //char *rec = GetControlRectangleText(i, layout->controls[i], config.defineRecs, config.exportAnchors, preText);
 
-                TextAppend(toolstr, TextFormat("if (%sActive)", GetControlNameParam(layout->controls[i].name, preText)), pos);
+                TextAppend(toolstr, CodeTextFormat("if (%sActive)", GetControlNameParam(layout->controls[i].name, preText)), pos);
                 ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
                 TextAppend(toolstr, "{", pos);
 
@@ -1101,40 +1366,40 @@ static void WriteControlDraw(unsigned char *toolstr, int *pos, int index, GuiLay
     // TODO: Define text for window, groupbox, buttons, toggles and dummyrecs
     switch (control.type)
     {
-        case GUI_WINDOWBOX: TextAppend(toolstr, TextFormat("%sActive = !GuiWindowBox(%s, %s);", name, rec, text), pos); break;
-        case GUI_GROUPBOX: TextAppend(toolstr, TextFormat("GuiGroupBox(%s, %s);", rec, text), pos); break;
-        case GUI_LINE: TextAppend(toolstr, TextFormat("GuiLine(%s, %s);", rec, text), pos); break;
-        case GUI_PANEL: TextAppend(toolstr, TextFormat("GuiPanel(%s, %s);", rec, text), pos); break;
-        case GUI_LABEL: TextAppend(toolstr, TextFormat("GuiLabel(%s, %s);", rec, text), pos); break;
+        case GUI_WINDOWBOX: TextAppend(toolstr, CodeTextFormat("%sActive = !GuiWindowBox(%s, %s);", name, rec, text), pos); break;
+        case GUI_GROUPBOX: TextAppend(toolstr, CodeTextFormat("GuiGroupBox(%s, %s);", rec, text), pos); break;
+        case GUI_LINE: TextAppend(toolstr, CodeTextFormat("GuiLine(%s, %s);", rec, text), pos); break;
+        case GUI_PANEL: TextAppend(toolstr, CodeTextFormat("GuiPanel(%s, %s);", rec, text), pos); break;
+        case GUI_LABEL: TextAppend(toolstr, CodeTextFormat("GuiLabel(%s, %s);", rec, text), pos); break;
         case GUI_BUTTON: 
-            if(!config.exportButtonFunctions) TextAppend(toolstr, TextFormat("%sPressed = GuiButton(%s, %s); ", name, rec, text), pos); 
-            else TextAppend(toolstr, TextFormat("if (GuiButton(%s, %s)) %s(); ", rec, text, TextToPascal(control.name)), pos); 
+            if(!config.exportButtonFunctions) TextAppend(toolstr, CodeTextFormat("%sPressed = GuiButton(%s, %s); ", name, rec, text), pos); 
+            else TextAppend(toolstr, CodeTextFormat("if (GuiButton(%s, %s)) %s(); ", rec, text, CodeTextToPascal(control.name)), pos); 
             break;
         case GUI_LABELBUTTON: 
-            if(!config.exportButtonFunctions) TextAppend(toolstr, TextFormat("%sPressed = GuiLabelButton(%s, %s);", name, rec, text), pos);
-            else TextAppend(toolstr, TextFormat("if (GuiLabelButton(%s, %s)) %s();", rec, text, TextToPascal(control.name)), pos); 
+            if(!config.exportButtonFunctions) TextAppend(toolstr, CodeTextFormat("%sPressed = GuiLabelButton(%s, %s);", name, rec, text), pos);
+            else TextAppend(toolstr, CodeTextFormat("if (GuiLabelButton(%s, %s)) %s();", rec, text, CodeTextToPascal(control.name)), pos); 
             break;
-        case GUI_CHECKBOX: TextAppend(toolstr, TextFormat("GuiCheckBox(%s, %s, &%sChecked);", rec, text, name), pos); break;
-        case GUI_TOGGLE: TextAppend(toolstr, TextFormat("GuiToggle(%s, %s, &%sActive);", rec, text, name), pos); break;
-        case GUI_TOGGLEGROUP:TextAppend(toolstr, TextFormat("GuiToggleGroup(%s, %s, &%sActive);", rec, text, name), pos); break;
-        case GUI_COMBOBOX: TextAppend(toolstr, TextFormat("GuiComboBox(%s, %s, &%sActive);", rec, text, name), pos); break;
-        case GUI_DROPDOWNBOX: TextAppend(toolstr, TextFormat("if (GuiDropdownBox(%s, %s, &%sActive, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name), pos); break;
-        case GUI_TEXTBOX: TextAppend(toolstr, TextFormat("if (GuiTextBox(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name), pos); break;
-        case GUI_TEXTBOXMULTI: TextAppend(toolstr, TextFormat("if (GuiTextBoxMulti(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name), pos); break;
-        case GUI_VALUEBOX: TextAppend(toolstr, TextFormat("if (GuiValueBox(%s, %s, &%sValue, %d, %d, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, values[0], values[1], name, name, name), pos); break;
-        case GUI_SPINNER: TextAppend(toolstr, TextFormat("if (GuiSpinner(%s, %s, &%sValue, %d, %d, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, values[0], values[1], name, name, name), pos); break;
-        case GUI_SLIDER: TextAppend(toolstr, TextFormat("GuiSlider(%s, %s, NULL, &%sValue, %d, %d);", rec, text, name, values[0], values[1]), pos); break;
-        case GUI_SLIDERBAR: TextAppend(toolstr, TextFormat("GuiSliderBar(%s, %s, NULL, &%sValue, %d, %d);", rec, text, name, values[0], values[1]), pos); break;
-        case GUI_PROGRESSBAR: TextAppend(toolstr, TextFormat("GuiProgressBar(%s, %s, NULL, &%sValue, %d, %d);", rec, text, name, values[0], values[1]), pos); break;
-        case GUI_STATUSBAR: TextAppend(toolstr, TextFormat("GuiStatusBar(%s, %s);", rec, text), pos); break;
+        case GUI_CHECKBOX: TextAppend(toolstr, CodeTextFormat("GuiCheckBox(%s, %s, &%sChecked);", rec, text, name), pos); break;
+        case GUI_TOGGLE: TextAppend(toolstr, CodeTextFormat("GuiToggle(%s, %s, &%sActive);", rec, text, name), pos); break;
+        case GUI_TOGGLEGROUP:TextAppend(toolstr, CodeTextFormat("GuiToggleGroup(%s, %s, &%sActive);", rec, text, name), pos); break;
+        case GUI_COMBOBOX: TextAppend(toolstr, CodeTextFormat("GuiComboBox(%s, %s, &%sActive);", rec, text, name), pos); break;
+        case GUI_DROPDOWNBOX: TextAppend(toolstr, CodeTextFormat("if (GuiDropdownBox(%s, %s, &%sActive, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name), pos); break;
+        case GUI_TEXTBOX: TextAppend(toolstr, CodeTextFormat("if (GuiTextBox(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name), pos); break;
+        case GUI_TEXTBOXMULTI: TextAppend(toolstr, CodeTextFormat("if (GuiTextBoxMulti(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name), pos); break;
+        case GUI_VALUEBOX: TextAppend(toolstr, CodeTextFormat("if (GuiValueBox(%s, %s, &%sValue, %d, %d, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, values[0], values[1], name, name, name), pos); break;
+        case GUI_SPINNER: TextAppend(toolstr, CodeTextFormat("if (GuiSpinner(%s, %s, &%sValue, %d, %d, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, values[0], values[1], name, name, name), pos); break;
+        case GUI_SLIDER: TextAppend(toolstr, CodeTextFormat("GuiSlider(%s, %s, NULL, &%sValue, %d, %d);", rec, text, name, values[0], values[1]), pos); break;
+        case GUI_SLIDERBAR: TextAppend(toolstr, CodeTextFormat("GuiSliderBar(%s, %s, NULL, &%sValue, %d, %d);", rec, text, name, values[0], values[1]), pos); break;
+        case GUI_PROGRESSBAR: TextAppend(toolstr, CodeTextFormat("GuiProgressBar(%s, %s, NULL, &%sValue, %d, %d);", rec, text, name, values[0], values[1]), pos); break;
+        case GUI_STATUSBAR: TextAppend(toolstr, CodeTextFormat("GuiStatusBar(%s, %s);", rec, text), pos); break;
         case GUI_SCROLLPANEL:
         {
             char *containerRec = GetScrollPanelContainerRecText(index, control, config.defineRecs, config.exportAnchors, preText);
-            TextAppend(toolstr, TextFormat("GuiScrollPanel(%s, %s, %s, &%sScrollOffset, &%sScrollView);", containerRec, text, rec, name, name), pos); break;
+            TextAppend(toolstr, CodeTextFormat("GuiScrollPanel(%s, %s, %s, &%sScrollOffset, &%sScrollView);", containerRec, text, rec, name, name), pos); break;
         }
-        case GUI_LISTVIEW: TextAppend(toolstr, TextFormat("GuiListView(%s, %s, &%sScrollIndex, &%sActive);", rec, (text == NULL)? "null" : text, name, name), pos); break;
-        case GUI_COLORPICKER: TextAppend(toolstr, TextFormat("GuiColorPicker(%s, %s, &%sValue);", rec, text, name), pos); break;
-        case GUI_DUMMYREC: TextAppend(toolstr, TextFormat("GuiDummyRec(%s, %s);", rec, text), pos); break;
+        case GUI_LISTVIEW: TextAppend(toolstr, CodeTextFormat("GuiListView(%s, %s, &%sScrollIndex, &%sActive);", rec, (text == NULL)? "null" : text, name, name), pos); break;
+        case GUI_COLORPICKER: TextAppend(toolstr, CodeTextFormat("GuiColorPicker(%s, %s, &%sValue);", rec, text, name), pos); break;
+        case GUI_DUMMYREC: TextAppend(toolstr, CodeTextFormat("GuiDummyRec(%s, %s);", rec, text), pos); break;
         default: break;
     }
 }
@@ -1147,18 +1412,18 @@ static char *GetControlRectangleText(int index, GuiLayoutControl control, bool d
 
     if (defineRecs)
     {
-        strcpy(text, TextFormat("%slayoutRecs[%i]", preText, index));
+        strcpy(text, CodeTextFormat("%slayoutRecs[%i]", preText, index));
     }
     else
     {
         if (exportAnchors && control.ap->id > 0)
         {
-            strcpy(text, TextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i, %i }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height));
+            strcpy(text, CodeTextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i, %i }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height));
         }
         else
         {
-            if (control.ap->id > 0) strcpy(text, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, (int)control.rec.height));
-            else strcpy(text, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, (int)control.rec.height));
+            if (control.ap->id > 0) strcpy(text, CodeTextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, (int)control.rec.height));
+            else strcpy(text, CodeTextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, (int)control.rec.height));
         }
     }
 
@@ -1173,19 +1438,19 @@ static char *GetScrollPanelContainerRecText(int index, GuiLayoutControl control,
 
     if(defineRecs)
     {
-        strcpy(text, TextFormat("(Rectangle){%slayoutRecs[%i].x, %slayoutRecs[%i].y, %slayoutRecs[%i].width - %s%sBoundsOffset.x, %slayoutRecs[%i].height - %s%sBoundsOffset.y }", preText, index, preText, index, preText, index, preText, control.name, preText, index, preText, control.name));
+        strcpy(text, CodeTextFormat("(Rectangle){%slayoutRecs[%i].x, %slayoutRecs[%i].y, %slayoutRecs[%i].width - %s%sBoundsOffset.x, %slayoutRecs[%i].height - %s%sBoundsOffset.y }", preText, index, preText, index, preText, index, preText, control.name, preText, index, preText, control.name));
     }
     else
     {
         if (exportAnchors && control.ap->id > 0)
         {
-            strcpy(text, TextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
+            strcpy(text, CodeTextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
         }
         else
         {
             // DOING
-            if (control.ap->id > 0) strcpy(text, TextFormat("(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
-            else strcpy(text, TextFormat("(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y}", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
+            if (control.ap->id > 0) strcpy(text, CodeTextFormat("(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
+            else strcpy(text, CodeTextFormat("(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y}", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
 
         }
     }
@@ -1218,14 +1483,14 @@ static char *GetControlTextParam(GuiLayoutControl control, int defineTextAs, con
 
     if (isTextDefinable && defineTextAs != GUI_DEFINETEXT_NONE)
     {
-        if (defineTextAs == GUI_DEFINETEXT_CONST) strcpy(text, TextFormat("%sText", control.name));
-        else strcpy(text, TextFormat("%s%sText", preText, control.name));
+        if (defineTextAs == GUI_DEFINETEXT_CONST) strcpy(text, CodeTextFormat("%sText", control.name));
+        else strcpy(text, CodeTextFormat("%s%sText", preText, control.name));
     }
     else 
     {
         // NOTE: control.text will never be NULL
         if (control.text[0] == '\0') strcpy(text, "NULL");
-        else strcpy(text, TextFormat("\"%s\"", control.text));
+        else strcpy(text, CodeTextFormat("\"%s\"", control.text));
     }
 
     return text;
@@ -1237,7 +1502,7 @@ static char *GetControlNameParam(char *controlName, const char *preText)
     static char text[256];
     memset(text, 0, 256);
 
-    strcpy(text, TextFormat("%s%s", preText, controlName));
+    strcpy(text, CodeTextFormat("%s%s", preText, controlName));
 
     return text;
 }
@@ -1248,12 +1513,84 @@ static int* GetControlValuesParam(GuiLayoutControl control)
     static int values[2];
     const int maxDefault = control.type == GUI_PROGRESSBAR ? 1 : 100;
 
-    int count;
-    char** valuesText = TextSplit(control.values, ';', &count);
-    values[0] = count == 0 ? 0 : TextToInteger(valuesText[0]);
-    values[1] = count <= 1 ? maxDefault : TextToInteger(valuesText[1]);
+    // NOTE: Values are parsed in place, TextSplit() uses a shared buffer
+    const char *separator = strchr(control.values, ';');
+    values[0] = TextToInteger(control.values);
+    values[1] = (separator == NULL)? maxDefault : TextToInteger(separator + 1);
 
     return values;
 }
 
+//----------------------------------------------------------------------------------
+// Reentrant text functions
+//----------------------------------------------------------------------------------
+
+// Formatting of text with variables to 'embed'
+// NOTE: Rotating module buffers, as raylib TextFormat() but not shared with other threads
+static const char *CodeTextFormat(const char *text, ...)
+{
+    static char buffers[CODE_TEXT_BUFFERS_COUNT][CODE_TEXT_BUFFER_LENGTH] = { 0 };
+    static int index = 0;
+
+    char *currentBuffer = buffers[index];
+
+    va_list args;
+    va_start(args, text);
+    vsnprintf(currentBuffer, CODE_TEXT_BUFFER_LENGTH, text, args);
+    va_end(args);
+
+    index = (index + 1)%CODE_TEXT_BUFFERS_COUNT;
+
+    return currentBuffer;
+}
+
+// Get upper case version of provided string
+static const char *CodeTextToUpper(const char *text)
+{
+    static char buffer[CODE_TEXT_BUFFER_LENGTH] = { 0 };
+
+    int i = 0;
+    for (; (i < CODE_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++) buffer[i] = (char)toupper(text[i]);
+    buffer[i] = '\0';
+
+    return buffer;
+}
+
+// Get lower case version of provided string
+static const char *CodeTextToLower(const char *text)
+{
+    static char buffer[CODE_TEXT_BUFFER_LENGTH] = { 0 };
+
+    int i = 0;
+    for (; (i < CODE_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++) buffer[i] = (char)tolower(text[i]);
+    buffer[i] = '\0';
+
+    return buffer;
+}
+
+// Get Pascal case notation version of provided string
+// NOTE: Every '_' is removed and next character converted to upper case
+static const char *CodeTextToPascal(const char *text)
+{
+    static char buffer[CODE_TEXT_BUFFER_LENGTH] = { 0 };
+
+    int i = 0;
+    buffer[i++] = (char)toupper(text[0]);
+
+    for (int j = 1; (i < CODE_TEXT_BUFFER_LENGTH - 1) && (text[0] != '\0') && (text[j] != '\0'); i++, j++)
+    {
+        if (text[j] != '_') buffer[i] = text[j];
+        else
+        {
+            j++;
+            if (text[j] == '\0') break;
+            buffer[i] = (char)toupper(text[j]);
+        }
+    }
+
+    buffer[i] = '\0';
+
+    return buffer;
+}
+
 #endif // CODEGEN_IMPLEMENTATION
\ No newline at end of file
@@ -140,6 +140,11 @@
 *       #define RAYGUI_DEBUG_TEXT_BOUNDS
 *           Draw text bounds rectangles for debug
 *
+*       #define RAYGUI_NO_TEXT_CACHE
+*           Avoid text layout cache, text lines are decoded and measured on every draw.
+*           By default, measured glyph runs of short text lines are kept in a small LRU cache
+*           (RAYGUI_TEXT_CACHE_SETS*RAYGUI_TEXT_CACHE_WAYS entries) keyed by text, font and size
+*
 *   VERSIONS HISTORY:
 *       4.0 (12-Sep-2023) ADDED: GuiToggleSlider()
 *                         ADDED: GuiColorPickerHSV() and GuiColorPanelHSV()
@@ -682,6 +687,7 @@ RAYGUIAPI int GuiGetStyle(int control, int property);           // Get one style
 
 // Styles loading functions
 RAYGUIAPI void GuiLoadStyle(const char *fileName);              // Load style file over global style variable (.rgs)
+RAYGUIAPI void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize); // Load style from memory (binary .rgs only)
 RAYGUIAPI void GuiLoadStyleDefault(void);                       // Load style default over global style
 
 // Tooltips management functions
@@ -696,6 +702,7 @@ RAYGUIAPI void GuiSetIconScale(int scale);                      // Set default i
 RAYGUIAPI unsigned int *GuiGetIcons(void);                      // Get raygui icons data pointer
 RAYGUIAPI char **GuiLoadIcons(const char *fileName, bool loadIconsName); // Load raygui icons file (.rgi) into internal icons data
 RAYGUIAPI void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color); // Draw icon using pixel size at specified position
+RAYGUIAPI void GuiUnloadIconsAtlas(void);                       // Unload icons atlas texture (baked again on next icon drawing)
 #endif
 
 
@@ -1333,6 +1340,17 @@ static unsigned int *guiIconsPtr = guiIcons;
 
 #endif      // !RAYGUI_NO_ICONS && !RAYGUI_CUSTOM_ICONS
 
+#if !defined(RAYGUI_NO_ICONS) && !defined(RAYGUI_STANDALONE)
+// Icons atlas, icons are baked into a texture and drawn as a single textured quad
+// NOTE: Atlas is baked on first icon drawing, baked icons data is kept to detect icons changes
+// (GuiLoadIcons() or direct edition using GuiGetIcons()), changed icons are updated on drawing
+// WARNING: Atlas texture must be unloaded with GuiUnloadIconsAtlas() before closing the window
+#define RAYGUI_ICONS_ATLAS_COLUMNS      16          // Icons per atlas row
+
+static Texture2D guiIconsAtlas = { 0 };             // Icons atlas texture
+static unsigned int guiIconsAtlasData[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = { 0 };    // Icons data baked into atlas
+#endif
+
 #ifndef RAYGUI_ICON_SIZE
     #define RAYGUI_ICON_SIZE             0
 #endif
@@ -1343,12 +1361,40 @@ static unsigned int *guiIconsPtr = guiIcons;
 #define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of base properties
 #define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
 
+// Text layout cache configuration
+// NOTE: Cache is N-way set associative, least recently used entry of a set is replaced on miss
+#ifndef RAYGUI_TEXT_CACHE_SETS
+    #define RAYGUI_TEXT_CACHE_SETS          32      // Text layout cache sets
+#endif
+#ifndef RAYGUI_TEXT_CACHE_WAYS
+    #define RAYGUI_TEXT_CACHE_WAYS           8      // Text layout cache entries per set
+#endif
+#ifndef RAYGUI_TEXT_CACHE_MAX_LENGTH
+    #define RAYGUI_TEXT_CACHE_MAX_LENGTH    64      // Text line maximum length to be cached (bytes)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 // Gui control property style color element
 typedef enum { BORDER = 0, BASE, TEXT, OTHER } GuiPropertyElement;
 
+// Gui text run, measured glyphs of a text line (text layout cache entry)
+typedef struct {
+    unsigned int hash;                  // Text line hash (FNV-1a), 0 for empty entry
+    unsigned int fontId;                // Font texture id
+    const void *fontGlyphs;             // Font glyphs data, texture id could be reused by a new font
+    int fontSize;                       // Font size (DEFAULT, TEXT_SIZE)
+    int spacing;                        // Font spacing (DEFAULT, TEXT_SPACING)
+    int length;                         // Text line length in bytes
+    char text[RAYGUI_TEXT_CACHE_MAX_LENGTH];        // Text line copy, required to discard hash collisions
+    int glyphCount;                     // Glyphs count
+    int codepoints[RAYGUI_TEXT_CACHE_MAX_LENGTH];   // Glyphs codepoints
+    float offsets[RAYGUI_TEXT_CACHE_MAX_LENGTH];    // Glyphs horizontal offsets
+    float width;                        // Text line width
+    unsigned int lastUsed;              // Last usage stamp (LRU)
+} GuiTextRun;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -1387,6 +1433,11 @@ static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI
 
 static bool guiStyleLoaded = false;         // Style loaded flag for lazy style initialization
 
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+static GuiTextRun guiTextCache[RAYGUI_TEXT_CACHE_SETS*RAYGUI_TEXT_CACHE_WAYS] = { 0 };   // Text layout cache
+static unsigned int guiTextCacheStamp = 0;  // Text layout cache usage stamp (LRU)
+#endif
+
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
 //
@@ -1462,9 +1513,13 @@ static void DrawRectangleGradientV(int posX, int posY, int width, int height, Co
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
-static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize);    // Load style from memory (binary only)
+#if !defined(RAYGUI_NO_ICONS) && !defined(RAYGUI_STANDALONE)
+static void LoadIconsAtlas(void);                               // Bake all icons into icons atlas texture
+static void UpdateIconsAtlas(int iconId);                       // Update one icon on icons atlas texture
+#endif
 
 static int GetTextWidth(const char *text);                      // Gui get text width using gui font and style
+static const GuiTextRun *GetTextRun(const char *text, int length);  // Get text line measured glyphs from text layout cache
 static Rectangle GetTextBounds(int control, Rectangle bounds);  // Get text bounds considering control bounds
 static const char *GetTextIcon(const char *text, int *iconId);  // Get text icon if provided and move text cursor
 
@@ -3968,10 +4023,35 @@ void GuiLoadStyle(const char *fileName)
 {
     #define MAX_LINE_BUFFER_SIZE    256
 
-    bool tryBinary = false;
+    bool tryText = false;
 
-    // Try reading the files as text file first
-    FILE *rgsFile = fopen(fileName, "rt");
+    // Try reading the file as binary first, binary styles are loaded with a single read
+    // NOTE: Binary style files start with "rGS " signature, text style files start with '#' comments
+    FILE *rgsFile = fopen(fileName, "rb");
+
+    if (rgsFile != NULL)
+    {
+        fseek(rgsFile, 0, SEEK_END);
+        int fileDataSize = ftell(rgsFile);
+        fseek(rgsFile, 0, SEEK_SET);
+
+        if (fileDataSize > 12)
+        {
+            unsigned char *fileData = (unsigned char *)RAYGUI_MALLOC(fileDataSize*sizeof(unsigned char));
+            int readSize = (int)fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+
+            if ((readSize == fileDataSize) && (memcmp(fileData, "rGS ", 4) == 0)) GuiLoadStyleFromMemory(fileData, fileDataSize);
+            else tryText = true;
+
+            RAYGUI_FREE(fileData);
+        }
+        else tryText = true;
+
+        fclose(rgsFile);
+    }
+
+    if (tryText) rgsFile = fopen(fileName, "rt");
+    else rgsFile = NULL;
 
     if (rgsFile != NULL)
     {
@@ -4046,34 +4126,9 @@ void GuiLoadStyle(const char *fileName)
                 fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
             }
         }
-        else tryBinary = true;
 
         fclose(rgsFile);
     }
-
-    if (tryBinary)
-    {
-        rgsFile = fopen(fileName, "rb");
-
-        if (rgsFile != NULL)
-        {
-            fseek(rgsFile, 0, SEEK_END);
-            int fileDataSize = ftell(rgsFile);
-            fseek(rgsFile, 0, SEEK_SET);
-
-            if (fileDataSize > 0)
-            {
-                unsigned char *fileData = (unsigned char *)RAYGUI_MALLOC(fileDataSize*sizeof(unsigned char));
-                fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
-
-                GuiLoadStyleFromMemory(fileData, fileDataSize);
-
-                RAYGUI_FREE(fileData);
-            }
-
-            fclose(rgsFile);
-        }
-    }
 }
 
 // Load style default over global style
@@ -4291,9 +4346,22 @@ char **GuiLoadIcons(const char *fileName, bool loadIconsName)
     return guiIconsName;
 }
 
-// Draw selected icon using rectangles pixel-by-pixel
+// Draw selected icon using icons atlas texture, one textured quad per icon
 void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
 {
+    if ((iconId < 0) || (iconId >= RAYGUI_ICON_MAX_ICONS)) return;
+
+#if !defined(RAYGUI_STANDALONE)
+    // Bake icons atlas on first usage, update icon in case its data changed
+    if (guiIconsAtlas.id == 0) LoadIconsAtlas();
+    else if (memcmp(&guiIconsAtlasData[iconId*RAYGUI_ICON_DATA_ELEMENTS], &guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0) UpdateIconsAtlas(iconId);
+
+    Rectangle source = { (float)((iconId%RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE), (float)((iconId/RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE), (float)RAYGUI_ICON_SIZE, (float)RAYGUI_ICON_SIZE };
+    Rectangle dest = { (float)posX, (float)posY, (float)RAYGUI_ICON_SIZE*pixelSize, (float)RAYGUI_ICON_SIZE*pixelSize };
+
+    DrawTexturePro(guiIconsAtlas, source, dest, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, GuiFade(color, guiAlpha));
+#else
+    // NOTE: No textures available on standalone mode, icon pixels drawn as rectangles
     #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
 
     for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
@@ -4302,14 +4370,27 @@ void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
         {
             if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
             {
-            #if !defined(RAYGUI_STANDALONE)
-                GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ (float)posX + (k%RAYGUI_ICON_SIZE)*pixelSize, (float)posY + y*pixelSize, (float)pixelSize, (float)pixelSize }, 0, BLANK, color);
-            #endif
+                GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ (float)posX + (k%RAYGUI_ICON_SIZE)*pixelSize, (float)posY + y*pixelSize, (float)pixelSize, (float)pixelSize }, 0, RAYGUI_CLITERAL(Color){ 0, 0, 0, 0 }, color);
             }
 
             if ((k == 15) || (k == 31)) y++;
         }
     }
+
+    #undef BIT_CHECK
+#endif
+}
+
+// Unload icons atlas texture
+// NOTE: Atlas is baked again on next icon drawing, if required
+void GuiUnloadIconsAtlas(void)
+{
+#if !defined(RAYGUI_STANDALONE)
+    if (guiIconsAtlas.id > 0) UnloadTexture(guiIconsAtlas);
+
+    guiIconsAtlas = RAYGUI_CLITERAL(Texture2D){ 0 };
+    memset(guiIconsAtlasData, 0, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+#endif
 }
 
 // Set icon drawing size
@@ -4324,9 +4405,75 @@ void GuiSetIconScale(int scale)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+#if !defined(RAYGUI_NO_ICONS) && !defined(RAYGUI_STANDALONE)
+// Bake all icons into icons atlas texture
+// NOTE: Icon pixels are white (with alpha), tinted on drawing
+static void LoadIconsAtlas(void)
+{
+    #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
+
+    int atlasWidth = RAYGUI_ICONS_ATLAS_COLUMNS*RAYGUI_ICON_SIZE;
+    int atlasHeight = (RAYGUI_ICON_MAX_ICONS/RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE;
+
+    // Image data, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: 2 bytes per pixel
+    unsigned char *pixels = (unsigned char *)RAYGUI_CALLOC(atlasWidth*atlasHeight*2, 1);
+
+    for (int iconId = 0; iconId < RAYGUI_ICON_MAX_ICONS; iconId++)
+    {
+        int offsetX = (iconId%RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE;
+        int offsetY = (iconId/RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE;
+
+        for (int i = 0; i < RAYGUI_ICON_DATA_ELEMENTS; i++)
+        {
+            for (int k = 0; k < 32; k++)
+            {
+                if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+                {
+                    int x = offsetX + (i*32 + k)%RAYGUI_ICON_SIZE;
+                    int y = offsetY + (i*32 + k)/RAYGUI_ICON_SIZE;
+
+                    pixels[(y*atlasWidth + x)*2] = 255;
+                    pixels[(y*atlasWidth + x)*2 + 1] = 255;
+                }
+            }
+        }
+    }
+
+    Image atlas = { pixels, atlasWidth, atlasHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+    guiIconsAtlas = LoadTextureFromImage(atlas);
+    RAYGUI_FREE(pixels);
+
+    memcpy(guiIconsAtlasData, guiIconsPtr, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+}
+
+// Update one icon on icons atlas texture
+static void UpdateIconsAtlas(int iconId)
+{
+    unsigned char pixels[RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE*2] = { 0 };
+
+    for (int i = 0; i < RAYGUI_ICON_DATA_ELEMENTS; i++)
+    {
+        for (int k = 0; k < 32; k++)
+        {
+            if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+            {
+                pixels[(i*32 + k)*2] = 255;
+                pixels[(i*32 + k)*2 + 1] = 255;
+            }
+        }
+    }
+
+    Rectangle rec = { (float)((iconId%RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE), (float)((iconId/RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE), (float)RAYGUI_ICON_SIZE, (float)RAYGUI_ICON_SIZE };
+    UpdateTextureRec(guiIconsAtlas, rec, pixels);
+
+    memcpy(&guiIconsAtlasData[iconId*RAYGUI_ICON_DATA_ELEMENTS], &guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+}
+#endif
+
 // Load style from memory
 // WARNING: Binary files only
-static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
+// NOTE: Compressed data is decompressed directly from provided memory, no intermediate copies
+void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
 {
     unsigned char *fileDataPtr = (unsigned char *)fileData;
 
@@ -4409,16 +4556,11 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
             {
                 // Compressed font atlas image data (DEFLATE), it requires DecompressData()
                 int dataUncompSize = 0;
-                unsigned char *compData = (unsigned char *)RAYGUI_MALLOC(fontImageCompSize);
-                memcpy(compData, fileDataPtr, fontImageCompSize);
+                imFont.data = DecompressData(fileDataPtr, fontImageCompSize, &dataUncompSize);
                 fileDataPtr += fontImageCompSize;
 
-                imFont.data = DecompressData(compData, fontImageCompSize, &dataUncompSize);
-
                 // Security check, dataUncompSize must match the provided fontImageUncompSize
                 if (dataUncompSize != fontImageUncompSize) RAYGUI_LOG("WARNING: Uncompressed font atlas image data could be corrupted");
-
-                RAYGUI_FREE(compData);
             }
             else
             {
@@ -4451,18 +4593,12 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
                 if ((recsDataCompressedSize > 0) && (recsDataCompressedSize != recsDataSize))
                 {
                     // Recs data is compressed, uncompress it
-                    unsigned char *recsDataCompressed = (unsigned char *)RAYGUI_MALLOC(recsDataCompressedSize);
-
-                    memcpy(recsDataCompressed, fileDataPtr, recsDataCompressedSize);
-                    fileDataPtr += recsDataCompressedSize;
-
                     int recsDataUncompSize = 0;
-                    font.recs = (Rectangle *)DecompressData(recsDataCompressed, recsDataCompressedSize, &recsDataUncompSize);
+                    font.recs = (Rectangle *)DecompressData(fileDataPtr, recsDataCompressedSize, &recsDataUncompSize);
+                    fileDataPtr += recsDataCompressedSize;
 
                     // Security check, data uncompressed size must match the expected original data size
                     if (recsDataUncompSize != recsDataSize) RAYGUI_LOG("WARNING: Uncompressed font recs data could be corrupted");
-
-                    RAYGUI_FREE(recsDataCompressed);
                 }
                 else
                 {
@@ -4493,13 +4629,9 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
                 if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
                 {
                     // Glyphs data is compressed, uncompress it
-                    unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_MALLOC(glyphsDataCompressedSize);
-
-                    memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
-                    fileDataPtr += glyphsDataCompressedSize;
-
                     int glyphsDataUncompSize = 0;
-                    unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+                    unsigned char *glyphsDataUncomp = DecompressData(fileDataPtr, glyphsDataCompressedSize, &glyphsDataUncompSize);
+                    fileDataPtr += glyphsDataCompressedSize;
 
                     // Security check, data uncompressed size must match the expected original data size
                     if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
@@ -4515,7 +4647,6 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
                         glyphsDataUncompPtr += 16;
                     }
 
-                    RAYGUI_FREE(glypsDataCompressed);
                     RAYGUI_FREE(glyphsDataUncomp);
                 }
                 else
@@ -4590,15 +4721,22 @@ static int GetTextWidth(const char *text)
             textSize.y = (float)guiFont.baseSize*scaleFactor;
             float glyphWidth = 0.0f;
 
-            for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
+            // Get text width from cache if available
+            const GuiTextRun *run = GetTextRun(text, size);
+
+            if (run != NULL) textSize.x = run->width;
+            else
             {
-                int codepoint = GetCodepointNext(&text[i], &codepointSize);
-                int codepointIndex = GetGlyphIndex(guiFont, codepoint);
+                for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
+                {
+                    int codepoint = GetCodepointNext(&text[i], &codepointSize);
+                    int codepointIndex = GetGlyphIndex(guiFont, codepoint);
 
-                if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
+                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
 
-                textSize.x += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                    textSize.x += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                }
             }
         }
 
@@ -4735,6 +4873,80 @@ static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
     return width;
 }
 
+// Get text line measured glyphs from text layout cache
+// NOTE: On cache miss text line glyphs are decoded and measured, replacing the least recently
+// used entry of the set, NULL is returned if text line can not be cached (too long or no font)
+static const GuiTextRun *GetTextRun(const char *text, int length)
+{
+    const GuiTextRun *result = NULL;
+
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+    int fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+    int spacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+
+    if ((text == NULL) || (length <= 0) || (length > RAYGUI_TEXT_CACHE_MAX_LENGTH) || (guiFont.texture.id == 0)) return NULL;
+
+    // Get text line hash (FNV-1a), 0 is reserved for empty entries
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < length; i++) hash = (hash ^ (unsigned char)text[i])*16777619u;
+    if (hash == 0) hash = 1;
+
+    GuiTextRun *set = &guiTextCache[(hash%RAYGUI_TEXT_CACHE_SETS)*RAYGUI_TEXT_CACHE_WAYS];
+    GuiTextRun *run = &set[0];
+
+    guiTextCacheStamp++;
+
+    for (int i = 0; i < RAYGUI_TEXT_CACHE_WAYS; i++)
+    {
+        if ((set[i].hash == hash) && (set[i].length == length) &&
+            (set[i].fontId == guiFont.texture.id) && (set[i].fontGlyphs == guiFont.glyphs) &&
+            (set[i].fontSize == fontSize) && (set[i].spacing == spacing) &&
+            (memcmp(set[i].text, text, length) == 0))
+        {
+            set[i].lastUsed = guiTextCacheStamp;
+            return &set[i];
+        }
+
+        if (set[i].lastUsed < run->lastUsed) run = &set[i];
+    }
+
+    // Cache miss, decode and measure text line glyphs into least recently used entry
+    run->hash = hash;
+    run->fontId = guiFont.texture.id;
+    run->fontGlyphs = guiFont.glyphs;
+    run->fontSize = fontSize;
+    run->spacing = spacing;
+    run->length = length;
+    memcpy(run->text, text, length);
+    run->glyphCount = 0;
+    run->lastUsed = guiTextCacheStamp;
+
+    float scaleFactor = (float)fontSize/guiFont.baseSize;
+    float offsetX = 0.0f;
+
+    for (int c = 0, codepointSize = 0; c < length; c += codepointSize)
+    {
+        int codepoint = GetCodepointNext(&text[c], &codepointSize);
+        int index = GetGlyphIndex(guiFont, codepoint);
+
+        // NOTE: Bad bytes are drawn using the '?' symbol moving one byte
+        if (codepoint == 0x3f) codepointSize = 1;
+
+        run->codepoints[run->glyphCount] = codepoint;
+        run->offsets[run->glyphCount] = offsetX;
+        run->glyphCount++;
+
+        if (guiFont.glyphs[index].advanceX == 0) offsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)spacing);
+        else offsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)spacing);
+    }
+
+    run->width = offsetX;
+    result = run;
+#endif
+
+    return result;
+}
+
 // Gui draw text using default font
 static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint)
 {
@@ -4834,72 +5046,90 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
         int textOffsetY = 0;
         float textOffsetX = 0.0f;
         float glyphWidth = 0;
-        for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
-        {
-            int codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
-            int index = GetGlyphIndex(guiFont, codepoint);
 
-            // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-            // but we need to draw all of the bad bytes using the '?' symbol moving one byte
-            if (codepoint == 0x3f) codepointSize = 1;       // TODO: Review not recognized codepoints size
+        // Get cached glyph run for not wrapped text lines
+        const GuiTextRun *run = (wrapMode == TEXT_WRAP_NONE)? GetTextRun(lines[i], lineSize) : NULL;
 
-            // Wrap mode text measuring to space to validate if it can be drawn or
-            // a new line is required
-            if (wrapMode == TEXT_WRAP_CHAR)
+        if (run != NULL)
+        {
+            // Draw only required text glyphs fitting the textBounds.width
+            for (int g = 0; g < run->glyphCount; g++)
             {
-                // Get glyph width to check if it goes out of bounds
-                if (guiFont.glyphs[index].advanceX == 0) glyphWidth = ((float)guiFont.recs[index].width*scaleFactor);
-                else glyphWidth = (float)guiFont.glyphs[index].advanceX*scaleFactor;
-
-                // Jump to next line if current character reach end of the box limits
-                if ((textOffsetX + glyphWidth) > textBounds.width)
+                if ((run->codepoints[g] != ' ') && (run->codepoints[g] != '\t') && (run->offsets[g] <= textBounds.width))
                 {
-                    textOffsetX = 0.0f;
-                    textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+                    DrawTextCodepoint(guiFont, run->codepoints[g], RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + run->offsets[g], textBoundsPosition.y }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
                 }
             }
-            else if (wrapMode == TEXT_WRAP_WORD)
+        }
+        else
+        {
+            for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
             {
-                // Get width to next space in line
-                int nextSpaceIndex = 0;
-                float nextSpaceWidth = GetNextSpaceWidth(lines[i] + c, &nextSpaceIndex);
+                int codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
+                int index = GetGlyphIndex(guiFont, codepoint);
+
+                // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
+                // but we need to draw all of the bad bytes using the '?' symbol moving one byte
+                if (codepoint == 0x3f) codepointSize = 1;       // TODO: Review not recognized codepoints size
 
-                if ((textOffsetX + nextSpaceWidth) > textBounds.width)
+                // Wrap mode text measuring to space to validate if it can be drawn or
+                // a new line is required
+                if (wrapMode == TEXT_WRAP_CHAR)
                 {
-                    textOffsetX = 0.0f;
-                    textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+                    // Get glyph width to check if it goes out of bounds
+                    if (guiFont.glyphs[index].advanceX == 0) glyphWidth = ((float)guiFont.recs[index].width*scaleFactor);
+                    else glyphWidth = (float)guiFont.glyphs[index].advanceX*scaleFactor;
+
+                    // Jump to next line if current character reach end of the box limits
+                    if ((textOffsetX + glyphWidth) > textBounds.width)
+                    {
+                        textOffsetX = 0.0f;
+                        textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+                    }
                 }
+                else if (wrapMode == TEXT_WRAP_WORD)
+                {
+                    // Get width to next space in line
+                    int nextSpaceIndex = 0;
+                    float nextSpaceWidth = GetNextSpaceWidth(lines[i] + c, &nextSpaceIndex);
 
-                // TODO: Consider case: (nextSpaceWidth >= textBounds.width)
-            }
+                    if ((textOffsetX + nextSpaceWidth) > textBounds.width)
+                    {
+                        textOffsetX = 0.0f;
+                        textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+                    }
 
-            if (codepoint == '\n') break;   // WARNING: Lines are already processed manually, no need to keep drawing after this codepoint
-            else
-            {
-                // TODO: There are multiple types of spaces in Unicode,
-                // maybe it's a good idea to add support for more: http://jkorpela.fi/chars/spaces.html
-                if ((codepoint != ' ') && (codepoint != '\t'))      // Do not draw codepoints with no glyph
+                    // TODO: Consider case: (nextSpaceWidth >= textBounds.width)
+                }
+
+                if (codepoint == '\n') break;   // WARNING: Lines are already processed manually, no need to keep drawing after this codepoint
+                else
                 {
-                    if (wrapMode == TEXT_WRAP_NONE)
+                    // TODO: There are multiple types of spaces in Unicode,
+                    // maybe it's a good idea to add support for more: http://jkorpela.fi/chars/spaces.html
+                    if ((codepoint != ' ') && (codepoint != '\t'))      // Do not draw codepoints with no glyph
                     {
-                        // Draw only required text glyphs fitting the textBounds.width
-                        if (textOffsetX <= (textBounds.width - glyphWidth))
+                        if (wrapMode == TEXT_WRAP_NONE)
                         {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            // Draw only required text glyphs fitting the textBounds.width
+                            if (textOffsetX <= (textBounds.width - glyphWidth))
+                            {
+                                DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            }
                         }
-                    }
-                    else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
-                    {
-                        // Draw only glyphs inside the bounds
-                        if ((textBoundsPosition.y + textOffsetY) <= (textBounds.y + textBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
+                        else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
                         {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            // Draw only glyphs inside the bounds
+                            if ((textBoundsPosition.y + textOffsetY) <= (textBounds.y + textBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
+                            {
+                                DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            }
                         }
                     }
-                }
 
-                if (guiFont.glyphs[index].advanceX == 0) textOffsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-                else textOffsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                    if (guiFont.glyphs[index].advanceX == 0) textOffsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                    else textOffsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                }
             }
         }
 
@@ -8,6 +8,7 @@
 *       - Operate on file or memory buffer
 *       - Chunks data abstraction
 *       - Add custom chunks
+*       - Chunks editing session: file loaded once, chunks edited in memory, saved with a single write
 *
 *   LIMITATIONS:
 *       - No indexed color type supported (PLTE)
@@ -29,11 +30,21 @@
 *       #define RPNG_NO_STDIO
 *           Do not include FILE I/O API, only read/write from memory buffers
 *
+*       #define RPNG_NO_SIMD
+*           Do not use SIMD code paths (CRC32 carry-less multiply, SSE2/NEON scanlines unfiltering),
+*           only portable code is used
+*
+*       #define RPNG_PARALLEL_DEFLATE
+*           Compress large image data in independent blocks on multiple threads (pigz-style),
+*           blocks are stitched into a single valid zlib stream with combined Adler-32 checksum
+*           NOTE: Requires RPNG_DEFLATE_IMPLEMENTATION and pthreads, not available on MSVC and Web
+*
 *
 *   DEPENDENCIES: libc (C standard library)
 *       stdlib.h        Required for: malloc(), calloc(), free()
 *       string.h        Required for: memcmp(), memcpy()
 *       stdio.h         Required for: FILE, fopen(), fread(), fwrite(), fclose() (only if !RPNG_NO_STDIO)
+*       pthread.h       Required for: pthread_create(), pthread_join()... (only if RPNG_PARALLEL_DEFLATE)
 *
 *       rpng includes internally a copy of sdefl and sinfl libraries by Micha Mettke (@vurtun)
 *       sdelf and sinfl libraries are used for compression and decompression of deflate data streams
@@ -193,6 +204,30 @@ typedef struct {
 
 // A minimal PNG only requires: png_signature | rpng_chunk(IHDR) | rpng_chunk(IDAT) | rpng_chunk(IEND)
 
+// PNG scanline filter types, used on image saving
+// NOTE: Adaptive mode selects the best filter for every scanline
+typedef enum {
+    RPNG_FILTER_NONE = 0,       // Filter type 0: None
+    RPNG_FILTER_SUB,            // Filter type 1: Sub (left byte difference)
+    RPNG_FILTER_UP,             // Filter type 2: Up (above byte difference)
+    RPNG_FILTER_AVERAGE,        // Filter type 3: Average (left and above bytes average difference)
+    RPNG_FILTER_PAETH,          // Filter type 4: Paeth (Paeth predictor difference)
+    RPNG_FILTER_ADAPTIVE        // Per scanline selection, minimum sum of absolute differences (default)
+} rpng_filter;
+
+// PNG image scanline callback, called for every unfiltered scanline in order (top to bottom)
+// NOTE: Scanline data is only valid during the callback, row_size = width*color_channels*bit_depth/8
+typedef void (*rpng_row_callback)(const unsigned char *row, int y, int row_size, void *user_data);
+
+// PNG chunks editing session
+// NOTE: Chunks data is owned by the session, any number of edits can be applied
+// in memory and all of them are committed with a single file write
+typedef struct {
+    rpng_chunk *chunks;     // Chunks list (IHDR first, IEND last)
+    int count;              // Chunks count
+    int capacity;           // Chunks list capacity
+} rpng_session;
+
 #ifdef __cplusplus
 extern "C" {                // Prevents name mangling of functions
 #endif
@@ -212,12 +247,22 @@ extern "C" {                // Prevents name mangling of functions
 // NOTE: Color indexed image formats are not supported
 RPNGAPI char *rpng_load_image(const char *filename, int *width, int *height, int *color_channels, int *bit_depth);
 
+// Load a PNG file image data scanline by scanline, every unfiltered scanline is provided to callback
+// NOTE: Image data is decompressed in small chunks and unfiltered as scanlines are completed,
+// only compressed data, DEFLATE window (32 KB) and two scanlines are kept in memory (requires RPNG_DEFLATE_IMPLEMENTATION),
+// scanlines could be already provided when data is found corrupted (false returned)
+RPNGAPI bool rpng_load_image_rows(const char *filename, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth);
+
 // Save a PNG file from image data (IHDR, IDAT, IEND)
 //  - Color channels defines pixel color channels, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
 //  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit
 // NOTE: It's up to the user to provide the right data format as specified by color_channels and bit_depth
 RPNGAPI void rpng_save_image(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth);
 
+// Save a PNG file from image data (IHDR, IDAT, IEND), scanlines filter selection mode provided (rpng_filter)
+// NOTE: rpng_save_image() uses RPNG_FILTER_ADAPTIVE, a fixed filter is faster but output is usually bigger
+RPNGAPI void rpng_save_image_ex(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth, int filter);
+
 // Save a PNG file from indexed image data (IHDR, PLTE, (tRNS), IDAT, IEND)
 //  - Palette colours must be provided as R8G8B8, they are saved in PLTE chunk
 //  - Palette alpha should be provided as R8, it is saved in tRNS chunk (if not NULL)
@@ -249,7 +294,9 @@ RPNGAPI void rpng_chunk_split_image_data(const char *filename, int split_size);
 
 // Load and save png data from memory buffer
 RPNGAPI char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth);  // Load png data from memory buffer
+RPNGAPI bool rpng_load_image_rows_from_memory(const char *buffer, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth);  // Load png data scanlines from memory buffer
 RPNGAPI char *rpng_save_image_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, int *output_size); // Save png data to memory buffer
+RPNGAPI char *rpng_save_image_to_memory_ex(const char *data, int width, int height, int color_channels, int bit_depth, int filter, int *output_size);   // Save png data to memory buffer, filter mode provided
 
 // Read and write chunks from memory buffer
 RPNGAPI int rpng_chunk_count_from_memory(const char *buffer);                                               // Count the chunks in a PNG image from memory
@@ -261,6 +308,25 @@ RPNGAPI char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk,
 RPNGAPI char *rpng_chunk_combine_image_data_from_memory(char *buffer, int *output_size);                    // Combine multiple IDAT chunks into a single one
 RPNGAPI char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int *output_size);      // Split one IDAT chunk into multiple ones
 
+// Chunks editing session: load once, edit chunks in memory, save with a single write
+RPNGAPI rpng_session rpng_session_load(const char *filename);                                   // Load PNG file chunks into an editing session
+RPNGAPI rpng_session rpng_session_load_from_memory(const char *buffer, int size);              // Load PNG chunks from memory buffer into an editing session
+RPNGAPI void rpng_session_unload(rpng_session *session);                                       // Unload session chunks
+RPNGAPI bool rpng_session_save(rpng_session *session, const char *filename);                   // Save session chunks to PNG file (single write)
+RPNGAPI char *rpng_session_save_to_memory(rpng_session *session, int *output_size);            // Save session chunks to memory buffer
+RPNGAPI void rpng_session_chunk_write(rpng_session *session, rpng_chunk chunk);                 // Write one new chunk after IHDR (any kind, data copied)
+RPNGAPI void rpng_session_chunk_remove(rpng_session *session, const char *chunk_type);          // Remove one chunk type
+RPNGAPI void rpng_session_chunk_remove_ancillary(rpng_session *session);                       // Remove all chunks except: IHDR-PLTE-IDAT-IEND
+
+// Write specific chunks to session
+RPNGAPI void rpng_session_chunk_write_text(rpng_session *session, char *keyword, char *text);         // Write tEXt chunk
+RPNGAPI void rpng_session_chunk_write_comp_text(rpng_session *session, char *keyword, char *text);    // Write zTXt chunk, DEFLATE compressed text
+RPNGAPI void rpng_session_chunk_write_gamma(rpng_session *session, float gamma);                      // Write gAMA chunk (stored as int, gamma*100000)
+RPNGAPI void rpng_session_chunk_write_srgb(rpng_session *session, char srgb_type);                    // Write sRGB chunk, requires gAMA chunk
+RPNGAPI void rpng_session_chunk_write_time(rpng_session *session, short year, char month, char day, char hour, char min, char sec);   // Write tIME chunk
+RPNGAPI void rpng_session_chunk_write_physical_size(rpng_session *session, int pixels_unit_x, int pixels_unit_y, bool meters);        // Write pHYs chunk
+RPNGAPI void rpng_session_chunk_write_chroma(rpng_session *session, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y);  // Write cHRM chunk
+
 #ifdef __cplusplus
 }
 #endif
@@ -288,6 +354,56 @@ RPNGAPI char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_si
     #include <unistd.h>     // Required for: access() (POSIX, not C standard) [file_exists()]
 #endif
 
+// CRC32 carry-less multiply (PCLMULQDQ) and SSE2 unfiltering code paths, selected at runtime if supported by CPU
+#if !defined(RPNG_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+    #define RPNG_CRC32_CLMUL
+    #define RPNG_UNFILTER_SSE2
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #include <wmmintrin.h>      // Required for: _mm_clmulepi64_si128()
+    #if defined(_MSC_VER)
+        #include <intrin.h>     // Required for: __cpuid()
+        #define RPNG_TARGET_CLMUL
+        #define RPNG_TARGET_SSE2
+    #else
+        #include <cpuid.h>      // Required for: __get_cpuid()
+        #define RPNG_TARGET_CLMUL __attribute__((target("sse2,pclmul")))
+        #define RPNG_TARGET_SSE2 __attribute__((target("sse2")))
+    #endif
+#endif
+
+// CPU features detection state access, published with release/acquire ordering (thread safe)
+#if defined(RPNG_CRC32_CLMUL) || defined(RPNG_UNFILTER_SSE2)
+    #if defined(_MSC_VER)
+        #define RPNG_ATOMIC_LOAD(ptr) _InterlockedOr((volatile long *)(ptr), 0)
+        #define RPNG_ATOMIC_STORE(ptr, value) _InterlockedExchange((volatile long *)(ptr), (long)(value))
+    #else
+        #define RPNG_ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+        #define RPNG_ATOMIC_STORE(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+    #endif
+#endif
+
+// NEON unfiltering code path, available if compiler targets NEON (always on AArch64)
+#if !defined(RPNG_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define RPNG_UNFILTER_NEON
+    #include <arm_neon.h>       // Required for: NEON intrinsics
+#endif
+
+// Parallel deflate compression, sdefl non-final blocks generation required
+#if defined(RPNG_PARALLEL_DEFLATE) && defined(RPNG_DEFLATE_IMPLEMENTATION) && !defined(_MSC_VER) && !defined(__EMSCRIPTEN__)
+    #define RPNG_PARALLEL_DEFLATE_SUPPORT
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_mutex_lock()...
+#endif
+
+#ifndef RPNG_PARALLEL_DEFLATE_THREADS
+    #define RPNG_PARALLEL_DEFLATE_THREADS          4    // Maximum threads compressing blocks (including caller thread)
+#endif
+#ifndef RPNG_PARALLEL_DEFLATE_BLOCK_SIZE
+    #define RPNG_PARALLEL_DEFLATE_BLOCK_SIZE (256*1024) // Input data size per independent block
+#endif
+
+#define RPNG_INFLATE_WINDOW_SIZE     32768      // DEFLATE matches max distance, decompressed history kept on scanlines streaming
+#define RPNG_INFLATE_MAX_MATCH         258      // DEFLATE match max length
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -409,6 +525,26 @@ typedef struct {
     unsigned char second;           // 0 to 60 (yes, 60, for leap seconds; not 61, a common error)
 } rpng_chunk_tIME;
 
+#if defined(RPNG_PARALLEL_DEFLATE_SUPPORT)
+// Deflate block, compressed independently by a worker thread
+typedef struct {
+    const unsigned char *data;      // Block input data
+    int size;                       // Block input data size
+    int last;                       // Block is the last one of the stream
+    unsigned char *comp_data;       // Block compressed data (raw deflate, byte aligned)
+    int comp_size;                  // Block compressed data size
+    unsigned int adler;             // Block input data Adler-32
+} deflate_block;
+
+// Deflate blocks pool, shared by worker threads
+typedef struct {
+    deflate_block *blocks;          // Blocks to compress
+    int count;                      // Blocks count
+    int next;                       // Next block to compress
+    pthread_mutex_t mutex;          // Next block access mutex
+} deflate_pool;
+#endif
+
 // Other chunks (view documentation)
 //sBIT: Significant bits
 //sPLT: Suggested palette
@@ -425,17 +561,51 @@ typedef struct {
 //----------------------------------------------------------------------------------
 const unsigned char png_signature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a }; // PNG Signature
 
+#if defined(RPNG_UNFILTER_SSE2)
+static int unfilter_sse2_state = 0;             // CPU SSE2 support state, detected on first scanline unfiltering: 0-Not detected yet, 1-Not supported, 2-Supported
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static unsigned int swap_endian(unsigned int value);                // Swap integer from big<->little endian
+static int filter_scanline(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter);    // Filter scanline, returns sum of absolute differences
+static void unfilter_scanline(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter); // Reverse scanline filter
+#if defined(RPNG_UNFILTER_SSE2)
+static int init_unfilter_sse2(void);                                // Detect CPU SSE2 support, returns detection state
+static void unfilter_scanline_sse2(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter); // Reverse scanline filter (SSE2)
+#endif
+#if defined(RPNG_UNFILTER_NEON)
+static void unfilter_scanline_neon(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter); // Reverse scanline filter (NEON)
+#endif
+static unsigned char *load_image_data_compressed(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth, int *comp_data_size);  // Concatenate all IDAT chunks data (zlib stream)
+static unsigned char *load_image_data_filtered(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth);   // Decompress all IDAT chunks as a single stream
 static unsigned int compute_crc32(unsigned char *buffer, int size); // Compute CRC32
+static unsigned int update_crc32(unsigned int crc, const unsigned char *buffer, int size);  // Update CRC32 with new data
+static unsigned int compute_chunk_crc32(const unsigned char *type, const unsigned char *data, int length);  // Compute chunk CRC32 (type + data)
+#if defined(RPNG_PARALLEL_DEFLATE_SUPPORT)
+static unsigned char *zdeflate_parallel(const unsigned char *data, int size, int *comp_size);  // Compress data into zlib stream using multiple threads
+static void *deflate_worker(void *arg);                             // Compress pool blocks until no block is left
+static unsigned int combine_adler32(unsigned int adler1, unsigned int adler2, unsigned int size2);  // Combine Adler-32 of two consecutive buffers
+static unsigned sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len);
+#endif
 
 // Load/save png file data from/to memory buffer
 static char *load_file_to_buffer(const char *filename, int *bytes_read);
 static void save_file_from_buffer(const char *filename, void *data, int bytesToWrite);
+static int read_file_chunks(const char *filename, const char *chunk_type, rpng_chunk *chunks, int max_count);  // Read chunks from file, payloads not required are skipped
 static bool file_exists(const char *filename);                      // Check if the file exists
 
+// Generate specific chunks data, shared by file and session writers
+// NOTE: Chunk data is allocated, it must be freed by caller, CRC is computed on writing
+static rpng_chunk gen_chunk_text(char *keyword, char *text);       // Generate tEXt chunk
+static rpng_chunk gen_chunk_comp_text(char *keyword, char *text);  // Generate zTXt chunk, DEFLATE compressed text
+static rpng_chunk gen_chunk_gamma(float gamma);                     // Generate gAMA chunk
+static rpng_chunk gen_chunk_srgb(char srgb_type);                   // Generate sRGB chunk
+static rpng_chunk gen_chunk_time(short year, char month, char day, char hour, char min, char sec);    // Generate tIME chunk
+static rpng_chunk gen_chunk_physical_size(int pixels_unit_x, int pixels_unit_y, bool meters);         // Generate pHYs chunk
+static rpng_chunk gen_chunk_chroma(float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y);  // Generate cHRM chunk
+
 // sdelf and sinfl implementations placed at the end of file
 #define SDEFL_IMPLEMENTATION
 #define SINFL_IMPLEMENTATION
@@ -496,6 +666,7 @@ struct sdefl {
 extern int sdefl_bound(int in_len);
 extern int sdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 extern int zsdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
+extern int sdeflate_block(struct sdefl *s, void *o, const void *i, int n, int lvl, int last);  // rpng: non-final blocks support (only RPNG_DEFLATE_IMPLEMENTATION)
 
 //=========================================================================
 //                           SINFL
@@ -507,8 +678,14 @@ extern int zsdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 
 struct sinfl {
   const unsigned char *bitptr;
+  const unsigned char *bitend;
   unsigned long long bitbuf;
   int bitcnt;
+  int bitover;
+
+  /* rpng: resumable decoding state */
+  int state, last;
+  unsigned stored;
 
   unsigned lits[SINFL_LIT_TBL_SIZE];
   unsigned dsts[SINFL_OFF_TBL_SIZE];
@@ -516,6 +693,10 @@ struct sinfl {
 
 extern int sinflate(void *out, int cap, const void *in, int size);
 extern int zsinflate(void *out, int cap, const void *in, int size);
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
+static int sinfl_run(struct sinfl *s, const unsigned char *o, unsigned char **pout, const unsigned char *oe, const unsigned char *stop);  // rpng: resumable decoding, scanlines streaming
+static unsigned sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len);
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -559,16 +740,37 @@ char *rpng_load_image(const char *filename, int *width, int *height, int *color_
     return data;
 }
 
+// Load a PNG file image data scanline by scanline, every unfiltered scanline is provided to callback
+bool rpng_load_image_rows(const char *filename, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    bool result = false;
+
+    int file_size = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size);
+
+    result = rpng_load_image_rows_from_memory(file_data, callback, user_data, width, height, color_channels, bit_depth);
+
+    RPNG_FREE(file_data);
+
+    return result;
+}
+
 // Save a PNG file from image data (IHDR, IDAT, IEND)
 //  - Color channels defines pixel color channels, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
 //  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit
 // NOTE: It's up to the user to provide the right data format as specified by color_channels and bit_depth
 void rpng_save_image(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth)
+{
+    rpng_save_image_ex(filename, data, width, height, color_channels, bit_depth, RPNG_FILTER_ADAPTIVE);
+}
+
+// Save a PNG file from image data (IHDR, IDAT, IEND), scanlines filter selection mode provided
+void rpng_save_image_ex(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth, int filter)
 {
     char *file_output = NULL;
     int file_output_size = 0;
 
-    file_output = rpng_save_image_to_memory(data, width, height, color_channels, bit_depth, &file_output_size);
+    file_output = rpng_save_image_to_memory_ex(data, width, height, color_channels, bit_depth, filter, &file_output_size);
 
     if ((file_output != NULL) && (file_output_size > 0)) save_file_from_buffer(filename, file_output, file_output_size);
     else RPNG_LOG("WARNING: PNG data saving failed");
@@ -588,28 +790,20 @@ void rpng_save_image_indexed(const char *filename, const char *data, int width,
 }
 
 // Count number of PNG chunks
+// NOTE: Only chunks headers are read, chunks data is skipped
 int rpng_chunk_count(const char *filename)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    int count = rpng_chunk_count_from_memory(file_data);
-
-    RPNG_FREE(file_data);
-
-    return count;
+    return read_file_chunks(filename, NULL, NULL, 0);
 }
 
 // Read one chunk from a PNG file
-// NOTE: There could be multiple chunks of same type, only first found is returned
+// NOTE: There could be multiple chunks of same type, only first found is returned,
+// other chunks data is skipped (not read)
 rpng_chunk rpng_chunk_read(const char *filename, const char *chunk_type)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = rpng_chunk_read_from_memory(file_data, chunk_type);
+    rpng_chunk chunk = { 0 };
 
-    RPNG_FREE(file_data);
+    read_file_chunks(filename, chunk_type, &chunk, 1);
 
     return chunk;
 }
@@ -617,18 +811,23 @@ rpng_chunk rpng_chunk_read(const char *filename, const char *chunk_type)
 // Read all chunks from a PNG file
 rpng_chunk *rpng_chunk_read_all(const char *filename, int *count)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    // We allocate enough space for 64 chunks
+    rpng_chunk *chunks = (rpng_chunk *)RPNG_CALLOC(RPNG_MAX_CHUNKS_COUNT, sizeof(rpng_chunk));
 
-    int counter = 0;
-    rpng_chunk *chunks = NULL;
+    int counter = read_file_chunks(filename, NULL, chunks, RPNG_MAX_CHUNKS_COUNT);
 
-    if (file_data != NULL)
+    if (counter > 0)
+    {
+        // Reallocate chunks size
+        rpng_chunk *chunks_resized = (rpng_chunk *)RPNG_REALLOC(chunks, counter*sizeof(rpng_chunk));
+        if (chunks_resized != NULL) chunks = chunks_resized;
+    }
+    else
     {
-        chunks = rpng_chunk_read_all_from_memory(file_data, &counter);
-        RPNG_FREE(file_data);
+        RPNG_FREE(chunks);
+        chunks = NULL;
+        RPNG_LOG("WARNING: File data could not be read\n");
     }
-    else RPNG_LOG("WARNING: File data could not be read\n");
 
     *count = counter;
     return chunks;
@@ -702,33 +901,9 @@ void rpng_chunk_write(const char *filename, rpng_chunk chunk)
 //   Comment          Miscellaneous comment
 void rpng_chunk_write_text(const char *filename, char *keyword, char *text)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    int keyword_len = (int)strlen(keyword);
-    int text_len = (int)strlen(text);
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "tEXt", 4);
-    chunk.length = keyword_len + 1 + text_len;
-    chunk.data = (unsigned char*)RPNG_CALLOC(chunk.length, 1);
-    memcpy(((unsigned char*)chunk.data), keyword, keyword_len);
-    memcpy(((unsigned char*)chunk.data) + keyword_len + 1, text, text_len);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = gen_chunk_text(keyword, text);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write zTXt chunk, DEFLATE compressed text
@@ -738,73 +913,18 @@ void rpng_chunk_write_text(const char *filename, char *keyword, char *text)
 //    unsigned char *comp_text;         // Compressed text: n bytes
 void rpng_chunk_write_comp_text(const char *filename, char *keyword, char *text)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    // Create chunk and fill with data
-    rpng_chunk chunk = { 0 };
-
-    int keyword_len = (int)strlen(keyword);
-    int text_len = (int)strlen(text);
-
-    // Compress filtered image data and generate a valid zlib stream
-    struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
-    int bounds = sdefl_bound(text_len);
-    unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
-    int comp_text_size = zsdeflate(sde, comp_text, (unsigned char *)text, text_len, 8);   // Compression level 8, same as stbiw
-    RPNG_FREE(sde);
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "zTXt", 4);
-    chunk.length = keyword_len + 1 + 1 + comp_text_size;
-    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
-    memcpy(chunk.data, keyword, keyword_len);
-    memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = gen_chunk_comp_text(keyword, text);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(comp_text);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write gAMA chunk
 // NOTE: Gamma is stored as one int: gamma*100000
 void rpng_chunk_write_gamma(const char *filename, float gamma)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    int gamma_value = (int)(gamma*100000);
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "gAMA", 4);
-    chunk.length = 4;
-    chunk.data = (unsigned char*)RPNG_CALLOC(chunk.length, 1);
-    gamma_value = swap_endian(gamma_value);
-    memcpy(((unsigned char*)chunk.data), &gamma_value, 4);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = gen_chunk_gamma(gamma);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write sRGB chunk, requires gAMA chunk
@@ -815,31 +935,9 @@ void rpng_chunk_write_gamma(const char *filename, float gamma)
 //   3: Absolute colorimetric
 void rpng_chunk_write_srgb(const char *filename, char srgb_type)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    if ((srgb_type < 0) || (srgb_type > 3)) srgb_type = 0;
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "sRGB", 4);
-    chunk.length = 1;
-    chunk.data = (unsigned char*)RPNG_CALLOC(chunk.length, 1);
-    memcpy(((unsigned char*)chunk.data), &srgb_type, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = gen_chunk_srgb(srgb_type);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write tIME chunk
@@ -852,34 +950,9 @@ void rpng_chunk_write_srgb(const char *filename, char srgb_type)
 //   unsigned char second;        // 0 to 60 (yes, 60, for leap seconds; not 61, a common error)
 void rpng_chunk_write_time(const char *filename, short year, char month, char day, char hour, char min, char sec)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "tIME", 4);
-    chunk.length = 7;
-    chunk.data = (unsigned char*)RPNG_CALLOC(chunk.length, 1);
-    memcpy(((unsigned char*)chunk.data), &year, 2);
-    memcpy(((unsigned char*)chunk.data) + 2, &month, 1);
-    memcpy(((unsigned char*)chunk.data) + 3, &day, 1);
-    memcpy(((unsigned char*)chunk.data) + 4, &hour, 1);
-    memcpy(((unsigned char*)chunk.data) + 5, &min, 1);
-    memcpy(((unsigned char*)chunk.data) + 6, &sec, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = gen_chunk_time(year, month, day, hour, min, sec);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write pHYs chunk
@@ -889,34 +962,9 @@ void rpng_chunk_write_time(const char *filename, short year, char month, char da
 //   unsigned char unit_specifier;       // 0 - Unit unknown, 1 - Unit is meter
 void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int pixels_unit_y, bool meters)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "pHYs", 4);
-    chunk.length = 9;
-    chunk.data = (unsigned char*)RPNG_CALLOC(chunk.length, 1);
-    pixels_unit_x = swap_endian(pixels_unit_x);
-    memcpy(((unsigned char*)chunk.data), &pixels_unit_x, 4);
-    pixels_unit_y = swap_endian(pixels_unit_y);
-    memcpy(((unsigned char*)chunk.data) + 4, &pixels_unit_y, 4);
-    char meters_value = (meters)? 1 : 0;
-    memcpy(((unsigned char*)chunk.data) + 8, &meters_value, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = gen_chunk_physical_size(pixels_unit_x, pixels_unit_y, meters);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write cHRM chunk
@@ -932,44 +980,9 @@ void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int
 // NOTE: Each value is stored as one int: value*100000
 void rpng_chunk_write_chroma(const char *filename, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "pHYs", 4);
-    chunk.length = 8*4;     // 8 integer values
-    chunk.data = (unsigned char*)RPNG_CALLOC(chunk.length, 1);
-    int white_x_value = swap_endian((int)(white_x*100000));
-    memcpy(((unsigned char*)chunk.data), &white_x_value, 4);
-    int white_y_value = swap_endian((int)(white_y*100000));
-    memcpy(((unsigned char*)chunk.data) + 4, &white_y_value, 4);
-    int red_x_value = swap_endian((int)(red_x*100000));
-    memcpy(((unsigned char*)chunk.data) + 8, &red_x_value, 4);
-    int red_y_value = swap_endian((int)(red_y*100000));
-    memcpy(((unsigned char*)chunk.data) + 12, &red_y_value, 4);
-    int green_x_value = swap_endian((int)(green_x*100000));
-    memcpy(((unsigned char*)chunk.data) + 16, &green_x_value, 4);
-    int green_y_value = swap_endian((int)(green_y*100000));
-    memcpy(((unsigned char*)chunk.data) + 20, &green_y_value, 4);
-    int blue_x_value = swap_endian((int)(blue_x*100000));
-    memcpy(((unsigned char*)chunk.data) + 24, &blue_x_value, 4);
-    int blue_y_value = swap_endian((int)(blue_y*100000));
-    memcpy(((unsigned char*)chunk.data) + 28, &blue_y_value, 4);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = gen_chunk_chroma(white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Output info about the chunks
@@ -1011,24 +1024,16 @@ bool rpng_chunk_check_all_valid(const char *filename)
     rpng_chunk *chunks = rpng_chunk_read_all(filename, &count);
     if (chunks == NULL) return false;
 
-    unsigned int crc = 0;
-    char *chunk_type_data = (char*)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);
-
-    if (chunk_type_data != NULL)
+    for (int i = 0; i < count; i++)
     {
-        for (int i = 0; i < count; i++)
-        {
-            memcpy(chunk_type_data, chunks[i].type, 4);
-            memcpy(chunk_type_data + 4, chunks[i].data, chunks[i].length);
-            crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunks[i].length);
-            crc = swap_endian(crc);
+        // NOTE: Chunk CRC is read from file already converted to host endianness
+        unsigned int crc = compute_chunk_crc32(chunks[i].type, chunks[i].data, chunks[i].length);
 
-            // Check computed CRC matches provided CRC
-            if (chunks[i].crc != crc)
-            {
-                result = false;
-                break;
-            }
+        // Check computed CRC matches provided CRC
+        if (chunks[i].crc != crc)
+        {
+            result = false;
+            break;
         }
     }
 
@@ -1074,169 +1079,169 @@ void rpng_chunk_split_image_data(const char *filename, int split_size)
 // Functions operating on memory buffers data
 //----------------------------------------------------------------------------------------------------------
 // Load png data from memory buffer
+// NOTE: Scanlines are unfiltered in place, only the decompressed image data buffer is allocated
 char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth)
 {
-    char *data = NULL;
-    void *data_piece[RPNG_MAX_CHUNKS_COUNT] = { 0 };
-    int data_piece_size[RPNG_MAX_CHUNKS_COUNT] = { 0 };
-    unsigned int dataChunkCounter = 0;
-
-    // Read all chunks
-    int count = 0;
-    rpng_chunk *chunks = rpng_chunk_read_all_from_memory(buffer, &count);
+    unsigned char *data = load_image_data_filtered(buffer, width, height, color_channels, bit_depth);
 
-    if (chunks == NULL) return data;
+    if (data != NULL)
+    {
+        int pixel_size = *color_channels*(*bit_depth/8);
+        int scanline_size = *width*pixel_size;
+        unsigned char *zero_scanline = (unsigned char *)RPNG_CALLOC(scanline_size, 1);   // Previous scanline for first row
+
+        // Reverse scanlines filters, every scanline is moved to its final position discarding the filter type byte
+        // NOTE: Scanline y is read from y*(1 + scanline_size) + 1 and written to y*scanline_size,
+        // writing position is always behind reading position, so data can be processed in place
+        for (int y = 0; y < *height; y++)
+        {
+            unsigned char *scanline = data + y*(1 + scanline_size);
+            unsigned char *prev_scanline = (y > 0)? data + (y - 1)*scanline_size : zero_scanline;
 
-    // First chunk is always IHDR, we can check image data info
-    rpng_chunk_IHDR *IHDRData = (rpng_chunk_IHDR *)chunks[0].data;
+            unfilter_scanline(data + y*scanline_size, scanline + 1, prev_scanline, scanline_size, pixel_size, scanline[0]);
+        }
 
-    *width = swap_endian(IHDRData->width);      // Image width
-    *height = swap_endian(IHDRData->height);    // Image height
-    *bit_depth = IHDRData->bit_depth;           // Bit depth
+        RPNG_FREE(zero_scanline);
 
-    *color_channels = 0;
-    switch (IHDRData->color_type)
-    {
-        case 0: *color_channels = 1; break;     // Pixel format: 0-Grayscale
-        case 4: *color_channels = 2; break;     // Pixel format: 4-GrayAlpha
-        case 2: *color_channels = 3; break;     // Pixel format: 2-RGB
-        case 6: *color_channels = 4; break;     // Pixel format: 6-RGBA
-        case 3: *color_channels = 0; break;     // Pixel format: 3-Indexed  (Not supported)
-        default: break;
+        // Shrink buffer to unfiltered image data size
+        unsigned char *data_resized = (unsigned char *)RPNG_REALLOC(data, (*height)*scanline_size);
+        if (data_resized != NULL) data = data_resized;
     }
 
-    if ((*color_channels == 1) && (*bit_depth != 8) && (*bit_depth != 16)) return data;  // Bit depth 1/2/4 not supported
+    return (char *)data;
+}
 
-    // Additional info provided by IHDR (in case it was required)
-    //IHDRData->compression;        // Compression method: 0 (DEFLATE)
-    //IHDRData->filter;             // Filter method: 0 (default)
-    //IHDRData->interlace;          // Interlace scheme (optional): 0 (none)
+// Load png data scanlines from memory buffer, every unfiltered scanline is provided to callback
+// NOTE: Image data is decompressed in chunks into a buffer holding the DEFLATE window (history required by matches),
+// one decoding chunk and two filtered scanlines; scanlines are unfiltered as soon as they are completed
+bool rpng_load_image_rows_from_memory(const char *buffer, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    bool result = false;
 
-    //int firstDataChunk = 0;
-    //bool consecutiveDataChunks = true;
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
+    int comp_data_size = 0;
+    unsigned char *comp_data = load_image_data_compressed(buffer, width, height, color_channels, bit_depth, &comp_data_size);
+
+    if (comp_data == NULL) return false;
+
+    int pixel_size = *color_channels*(*bit_depth/8);
+    int scanline_size = *width*pixel_size;
+    int filtered_size = 1 + scanline_size;     // Scanline data preceded by filter type byte
+
+    // NOTE: Decoding always stops with space for a max length match left, after moving the window
+    // to buffer start (keeping history and incomplete scanline) there is space for at least one chunk
+    int window_cap = 2*RPNG_INFLATE_WINDOW_SIZE + 2*filtered_size + RPNG_INFLATE_MAX_MATCH + 1;
+    unsigned char *window = (unsigned char *)RPNG_MALLOC(window_cap);
+    unsigned char *rows = (unsigned char *)RPNG_CALLOC(2*scanline_size, 1);
 
-    if (*color_channels != 0)
+    if ((window != NULL) && (rows != NULL) && (comp_data_size >= 6))
     {
-        for (int i = 1; i < count; i++)
+        unsigned char *prev_scanline = rows;                    // Zero initialized for first row
+        unsigned char *current_scanline = rows + scanline_size;
+
+        // Raw DEFLATE data, zlib header (2 bytes) and Adler-32 checksum (4 bytes) not included
+        struct sinfl inflator = { 0 };
+        inflator.bitptr = comp_data + 2;
+        inflator.bitend = comp_data + comp_data_size - 4;
+
+        unsigned char *out = window;            // Decompressed data end
+        unsigned char *scanline = window;       // Next filtered scanline start
+        unsigned int adler = 1;
+        int state = 1;                          // Decoding state: 1-Output space required, 0-Stream end, -1-Input overread
+        int y = 0;
+
+        while (state == 1)
         {
-            // NOTE: There can be multiple IDAT chunks; if so, they must appear
-            // consecutively with no other intervening chunks (not checked -> TODO)
-            if (memcmp(chunks[i].type, "IDAT", 4) == 0)     // Check IDAT chunk: image data
+            unsigned char *data_start = out;
+            state = sinfl_run(&inflator, window, &out, window + window_cap, window + window_cap - (RPNG_INFLATE_MAX_MATCH + 1));
+            adler = sinfl_adler32(adler, data_start, (int)(out - data_start));
+
+            // Reverse filters for all completed scanlines
+            while ((y < *height) && ((out - scanline) >= filtered_size))
             {
-                // Verify data integrity CRC
-                unsigned int crc = 0;
-                char *chunk_type_data = (char*)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);
-                memcpy(chunk_type_data, chunks[i].type, 4);
-                memcpy(chunk_type_data + 4, chunks[i].data, chunks[i].length);
-                crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunks[i].length);
-                RPNG_FREE(chunk_type_data);
-
-                if (crc == chunks[i].crc)
-                {
-                    data_piece[dataChunkCounter] = RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);
+                unfilter_scanline(current_scanline, scanline + 1, prev_scanline, scanline_size, pixel_size, scanline[0]);
+                if (callback != NULL) callback(current_scanline, y, scanline_size, user_data);
 
-                    // Decompress IDAT chunk data
-                    int data_decomp_size = zsinflate(data_piece[dataChunkCounter], RPNG_MAX_OUTPUT_SIZE, chunks[i].data, chunks[i].length);
+                // Current scanline becomes previous one
+                unsigned char *temp = prev_scanline;
+                prev_scanline = current_scanline;
+                current_scanline = temp;
 
-                    RPNG_LOG("INFO: IDAT data decompressed: %i -> %i\n", chunks[i].length, data_decomp_size);
+                scanline += filtered_size;
+                y++;
+            }
 
-                    if (data_decomp_size <= 0)
-                    {
-                        RPNG_LOG("WARNING: IDAT image data chunk decompression failed\n");
-                        break;
-                    }
+            if ((y == *height) && (out != scanline)) break;     // WARNING: Image data exceeded
 
-                    // Now we have the data decompressed but every scanline of the image was originally filtered for
-                    // maximum compression and one extra byte with the filter type was added to every scanline
-                    // We must undo that image prefiltering for every scanline
+            if (state == 1)
+            {
+                // Move window to buffer start, keeping matches history and incomplete scanline
+                unsigned char *keep = ((out - window) > RPNG_INFLATE_WINDOW_SIZE)? out - RPNG_INFLATE_WINDOW_SIZE : window;
+                if (scanline < keep) keep = scanline;
 
-                    // Image data reverse pre-processing for filter type
-                    int pixel_size = *color_channels*(*bit_depth/8);
-                    int scanline_size = *width*pixel_size;
-                    unsigned char *data_filtered = (unsigned char *)data_piece[dataChunkCounter];
-                    unsigned char *data_unfiltered = (unsigned char *)RPNG_CALLOC(data_decomp_size, 1);  // Actually data unfiltered size should be smaller
+                memmove(window, keep, out - keep);
+                scanline -= (keep - window);
+                out -= (keep - window);
+            }
+        }
 
-                    int current_filter = 0;
-                    int out = 0, x = 0, a = 0, b = 0, c = 0;
+        // Check all scanlines decompressed, with no additional data, and checksum matches
+        const unsigned char *eob = comp_data + comp_data_size - 4;
+        unsigned int checksum = ((unsigned int)eob[0] << 24) | ((unsigned int)eob[1] << 16) | ((unsigned int)eob[2] << 8) | (unsigned int)eob[3];
 
-                    // Reverse scanlines filters
-                    for (int y = 0; y < *height; y++)   // Move scanline by scanline, we must discard first byte = current_filter
-                    {
-                        current_filter = (int)data_filtered[(1 + scanline_size)*y];
-
-                        for (int p = 0; p < scanline_size; p++)
-                        {
-                            // x = current byte
-                            // a = left pixel byte (from current)
-                            // b = above pixel byte (from current)
-                            // c = left pixel byte (from b)
-                            x = (int)(data_filtered[(1 + scanline_size)*y + 1 + p]);
-                            a = (p >= pixel_size) ? (int)(data_unfiltered[scanline_size*y + p - pixel_size]) : 0;
-                            b = (y > 0) ? (int)(data_unfiltered[scanline_size*(y - 1) + p]) : 0;
-                            c = (y > 0) ? ((p >= pixel_size) ? (int)(data_unfiltered[scanline_size*(y - 1) + p - pixel_size]) : 0) : 0;
-
-                            switch (current_filter)
-                            {
-                                case 0: out = x; break;         // Filter type 0: None
-                                case 1: out = x + a; break;     // Filter type 1: Sub
-                                case 2: out = x + b; break;     // Filter type 2: Up
-                                case 3: out = x + ((a + b)>>1); break;    // Filter type 3: Average
-                                case 4: out = x + rpng_paeth_predictor(a, b, c); break;  // Filter type 4: Paeth
-                                default: break;
-                            }
-
-                            // Register scanline unfiltered values, byte by byte
-                            data_unfiltered[y*scanline_size + p] = (unsigned char)out;
-                        }
-                    }
-
-                    RPNG_FREE(data_piece[dataChunkCounter]);
-                    data_piece[dataChunkCounter] = data_unfiltered;
-                    data_piece_size[dataChunkCounter] = data_decomp_size - (*height);
-                }
-                else
-                {
-                    RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
-                    break;
-                }
+        if ((state == 0) && (y == *height) && (scanline == out) && (adler == checksum)) result = true;
+        else RPNG_LOG("WARNING: IDAT image data decompression failed\n");
+    }
 
-                dataChunkCounter++;
-            }
+    RPNG_FREE(rows);
+    RPNG_FREE(window);
+    RPNG_FREE(comp_data);
+#else
+    // NOTE: Resumable decompression not available with external sinfl, all image data is decompressed at once
+    unsigned char *data = load_image_data_filtered(buffer, width, height, color_channels, bit_depth);
 
-            if (i > (RPNG_MAX_CHUNKS_COUNT - 1))
-            {
-                RPNG_LOG("WARNING: PNG has more chunks than expected (supported limit: %i)\n", RPNG_MAX_CHUNKS_COUNT);
-                break;
-            }
-        }
-    }
-    else RPNG_LOG("WARNING: Failed to load file, image pixel format not supported\n");
+    if (data == NULL) return false;
 
-    // Free chunks memory
-    for (int i = 0; i < count; i++) RPNG_FREE(chunks[i].data);
-    RPNG_FREE(chunks);
+    int pixel_size = *color_channels*(*bit_depth/8);
+    int scanline_size = *width*pixel_size;
+    unsigned char *rows = (unsigned char *)RPNG_CALLOC(2*scanline_size, 1);
 
-    if (dataChunkCounter == 1) data = (char*)data_piece[0];
-    else
+    if (rows != NULL)
     {
-        // Load enough memory for all image uncompressed data
-        data = (char *)RPNG_CALLOC((*width)*(*height)*(*color_channels)*(*bit_depth/8), 1);
+        unsigned char *prev_scanline = rows;                    // Zero initialized for first row
+        unsigned char *current_scanline = rows + scanline_size;
 
-        // Concatenate all data chunks (already uncompressed and unfiltered)
-        for (unsigned int i = 0; i < dataChunkCounter; i++)
+        for (int y = 0; y < *height; y++)
         {
-            memcpy(data, data_piece[i], data_piece_size[i]);
-            data += data_piece_size[i];
+            unsigned char *scanline = data + y*(1 + scanline_size);
+
+            unfilter_scanline(current_scanline, scanline + 1, prev_scanline, scanline_size, pixel_size, scanline[0]);
+            if (callback != NULL) callback(current_scanline, y, scanline_size, user_data);
+
+            // Current scanline becomes previous one
+            unsigned char *temp = prev_scanline;
+            prev_scanline = current_scanline;
+            current_scanline = temp;
         }
 
-        for (unsigned int i = 0; i < dataChunkCounter; i++) RPNG_FREE(data_piece[i]);
+        result = true;
     }
 
-    return data;
+    RPNG_FREE(rows);
+    RPNG_FREE(data);
+#endif
+
+    return result;
 }
 
 // Save png data to memory buffer
 char *rpng_save_image_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, int *output_size)
+{
+    return rpng_save_image_to_memory_ex(data, width, height, color_channels, bit_depth, RPNG_FILTER_ADAPTIVE, output_size);
+}
+
+// Save png data to memory buffer, scanlines filter selection mode provided
+char *rpng_save_image_to_memory_ex(const char *data, int width, int height, int color_channels, int bit_depth, int filter, int *output_size)
 {
     char *output_buffer = NULL;
     int output_buffer_size = 0;
@@ -1251,6 +1256,8 @@ char *rpng_save_image_to_memory(const char *data, int width, int height, int col
 
     if (color_type == -1) return output_buffer;   // Number of channels not supported
 
+    if ((filter < RPNG_FILTER_NONE) || (filter > RPNG_FILTER_ADAPTIVE)) filter = RPNG_FILTER_ADAPTIVE;
+
     rpng_chunk_IHDR image_info = { 0 };
     image_info.width = swap_endian(width);
     image_info.height = swap_endian(height);
@@ -1263,90 +1270,71 @@ char *rpng_save_image_to_memory(const char *data, int width, int height, int col
     unsigned int data_filtered_size = (scanline_size + 1)*height;   // Adding 1 byte per scanline filter
     unsigned char *data_filtered = (unsigned char *)RPNG_CALLOC(data_filtered_size, 1);
 
-    int out = 0, x = 0, a = 0, b = 0, c = 0;
-    int sum_value[5] = { 0 };
-    int best_filter = 0;
+    // NOTE: First scanline is filtered against a zero scanline, as defined by PNG specs
+    unsigned char *zero_scanline = (unsigned char *)RPNG_CALLOC(scanline_size, 1);
+    unsigned char *candidates = NULL;     // Scanline filtered with every filter type (adaptive mode)
+    if (filter == RPNG_FILTER_ADAPTIVE) candidates = (unsigned char *)RPNG_MALLOC(5*scanline_size);
 
     for (int y = 0; y < height; y++)
     {
-        // Choose the best filter type for every scanline
-        // REF: https://www.w3.org/TR/PNG-Encoders.html#E.Filter-selection
-        for (int p = 0; p < scanline_size; p++)
+        const unsigned char *scanline = (const unsigned char *)data + scanline_size*y;
+        const unsigned char *prev_scanline = (y > 0)? (scanline - scanline_size) : zero_scanline;
+        unsigned char *output = data_filtered + (scanline_size + 1)*y;
+
+        if (filter == RPNG_FILTER_ADAPTIVE)
         {
-            // x = current byte
-            // a = left pixel byte (from current)
-            // b = above pixel byte (from current)
-            // c = left pixel byte (from b)
-            x = (int)((unsigned char *)data)[scanline_size*y + p];
-            a = (p >= pixel_size) ? (int)((unsigned char *)data)[scanline_size*y + p - pixel_size] : 0;
-            b = (y > 0) ? (int)((unsigned char *)data)[scanline_size*(y - 1) + p] : 0;
-            c = (y > 0) ? ((p >= pixel_size) ? (int)((unsigned char *)data)[scanline_size*(y - 1) + p - pixel_size] : 0) : 0;
-
-            // Heuristic: Compute the output scanline using all five filters
-            // REF: https://www.w3.org/TR/PNG/#9Filters
-            for (int filter = 0; filter < 5; filter++)
+            // Choose the best filter type for every scanline
+            // Select the filter that gives the smallest sum of absolute values of outputs,
+            // considering the output bytes as signed differences for the test
+            // REF: https://www.w3.org/TR/PNG-Encoders.html#E.Filter-selection
+            int best_filter = 0;
+            int best_value = 0;
+
+            for (int f = 0; f < 5; f++)
             {
-                switch(filter)
+                int value = filter_scanline(candidates + f*scanline_size, scanline, prev_scanline, scanline_size, pixel_size, f);
+
+                if ((f == 0) || (value < best_value))
                 {
-                    case 0: out = x; break;
-                    case 1: out = x - a; break;
-                    case 2: out = x - b; break;
-                    case 3: out = x - ((a + b)>>1); break;
-                    case 4: out = x - rpng_paeth_predictor(a, b, c); break;
-                    default: break;
+                    best_value = value;
+                    best_filter = f;
                 }
-
-                sum_value[filter] += abs((signed char)out);
             }
-        }
 
-        // Select the filter that gives the smallest sum of absolute values of outputs.
-        // NOTE: Considering the output bytes as signed differences for the test.
-        best_filter = 0;
-        int best_value = sum_value[0];
-
-        for (int filter = 1; filter < 5; filter++)
+            // Register scanline filter byte and filtered values
+            output[0] = (unsigned char)best_filter;
+            memcpy(output + 1, candidates + best_filter*scanline_size, scanline_size);
+        }
+        else
         {
-            if (sum_value[filter] < best_value)
-            {
-                best_value = sum_value[filter];
-                best_filter = filter;
-            }
+            output[0] = (unsigned char)filter;
+            filter_scanline(output + 1, scanline, prev_scanline, scanline_size, pixel_size, filter);
         }
+    }
 
-        // Register scanline filter byte
-        data_filtered[(scanline_size + 1)*y] = best_filter;
+    RPNG_FREE(candidates);
+    RPNG_FREE(zero_scanline);
 
-        // Apply the best_filter to scanline
-        for (int p = 0; p < scanline_size; p++)
-        {
-            x = (int)((unsigned char *)data)[scanline_size*y + p];
-            a = (p >= pixel_size)? (int)((unsigned char *)data)[scanline_size*y + p - pixel_size] : 0;
-            b = (y > 0)? (int)((unsigned char *)data)[scanline_size*(y - 1) + p] : 0;
-            c = (y > 0)? ((p >= pixel_size) ? (int)((unsigned char *)data)[scanline_size*(y - 1) + p - pixel_size] : 0) : 0;
+    // Compress filtered image data and generate a valid zlib stream
+    unsigned char *comp_data = NULL;
+    int comp_data_size = 0;
 
-            switch (best_filter)
-            {
-                case 0: out = x; break;
-                case 1: out = x - a; break;
-                case 2: out = x - b; break;
-                case 3: out = x - ((a + b)>>1); break;
-                case 4: out = x - rpng_paeth_predictor(a, b, c); break;
-                default: break;
-            }
+#if defined(RPNG_PARALLEL_DEFLATE_SUPPORT)
+    // NOTE: Large image data is compressed in independent blocks by multiple threads,
+    // on failure it falls back to single stream compression
+    if (data_filtered_size >= 2*RPNG_PARALLEL_DEFLATE_BLOCK_SIZE) comp_data = zdeflate_parallel(data_filtered, data_filtered_size, &comp_data_size);
+#endif
 
-            // Register scanline filtered values, byte by byte
-            data_filtered[(scanline_size + 1)*y + 1 + p] = (unsigned char)out;
-        }
+    if (comp_data == NULL)
+    {
+        struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
+        int bounds = sdefl_bound(data_filtered_size);
+        comp_data = (unsigned char *)RPNG_CALLOC(bounds, 1);
+        comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, 8);   // Compression level 8, same as stbiw
+        RPNG_FREE(sde);
     }
 
-    // Compress filtered image data and generate a valid zlib stream
-    struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
-    int bounds = sdefl_bound(data_filtered_size);
-    unsigned char *comp_data = (unsigned char *)RPNG_CALLOC(bounds, 1);
-    int comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, 8);   // Compression level 8, same as stbiw
     RPNG_FREE(data_filtered);
-    RPNG_FREE(sde);
 
     RPNG_LOG("INFO: rpng_save_image: data size: %i -> Comp data size: %i\n", data_filtered_size, comp_data_size);
 
@@ -1630,15 +1618,10 @@ char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *ou
                 memcpy(output_buffer + output_buffer_size + 4, chunk.type, 4);                // Write chunk type
                 memcpy(output_buffer + output_buffer_size + 4 + 4, chunk.data, chunk.length); // Write chunk data
 
-                unsigned char *type_data = (unsigned char*)RPNG_MALLOC(4 + chunk.length);
-                memcpy(type_data, chunk.type, 4);
-                memcpy(type_data + 4, chunk.data, chunk.length);
-                unsigned int crc = compute_crc32(type_data, 4 + chunk.length);
+                unsigned int crc = compute_chunk_crc32(chunk.type, chunk.data, chunk.length);
                 crc = swap_endian(crc);
                 memcpy(output_buffer + output_buffer_size + 4 + 4 + chunk.length, &crc, 4);   // Write CRC32 (computed over type + data)
 
-                RPNG_FREE(type_data);
-
                 output_buffer_size += (4 + 4 + chunk.length + 4);  // Update output file file_size with new chunk
             }
 
@@ -1759,115 +1742,1311 @@ char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int
                     crc = swap_endian(crc);
                     memcpy(idata_split_buffer + 4 + 4 + split_size, &crc, 4);
 
-                    chunk_remain_size -= split_size;
-                    buffer_ptr_offset += split_size;
+                    chunk_remain_size -= split_size;
+                    buffer_ptr_offset += split_size;
+
+                    memcpy(output_buffer + output_buffer_size, idata_split_buffer, split_size + 12);
+                    output_buffer_size += (split_size + 12);
+                }
+
+                // Save last IDAT chunk piece
+                unsigned int chunk_remain_size_be = swap_endian(chunk_remain_size);
+                memcpy(idata_split_buffer, &chunk_remain_size_be, 4);
+                memcpy(idata_split_buffer + 4, "IDAT", 4);
+                memcpy(idata_split_buffer + 4 + 4, buffer_ptr_offset, chunk_remain_size);
+                unsigned int crc = compute_crc32((unsigned char *)(idata_split_buffer + 4), 4 + chunk_remain_size);
+                crc = swap_endian(crc);
+                memcpy(idata_split_buffer + 4 + 4 + chunk_remain_size, &crc, 4);
+
+                memcpy(output_buffer + output_buffer_size, idata_split_buffer, chunk_remain_size + 12);
+                output_buffer_size += (chunk_remain_size + 12);
+            }
+            else
+            {
+                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
+                output_buffer_size += (4 + 4 + chunk_size + 4);
+            }
+
+            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
+            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        }
+
+        RPNG_FREE(idata_split_buffer);
+
+        // Write IEND chunk
+        memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + 4);
+        output_buffer_size += 12;
+
+        // Resize output buffer
+        char *output_buffer_sized = (char *)RPNG_REALLOC(output_buffer, output_buffer_size);
+        if (output_buffer_sized != NULL) output_buffer = output_buffer_sized;
+    }
+
+    *output_size = output_buffer_size;
+    return output_buffer;
+}
+
+// Chunks editing session functions
+//----------------------------------------------------------------------------------------------------------
+// Load PNG file chunks into an editing session
+// NOTE: File is read once, session chunks own their data
+rpng_session rpng_session_load(const char *filename)
+{
+    int file_size = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size);
+
+    rpng_session session = rpng_session_load_from_memory(file_data, file_size);
+
+    RPNG_FREE(file_data);
+
+    return session;
+}
+
+// Load PNG chunks from memory buffer into an editing session
+// NOTE: Chunks are bounds checked against buffer size, session is empty (chunks = NULL) on failure
+rpng_session rpng_session_load_from_memory(const char *buffer, int size)
+{
+    rpng_session session = { 0 };
+
+    if ((buffer == NULL) || (size < (8 + 12)) || (memcmp(buffer, png_signature, 8) != 0)) return session;  // Check valid PNG file
+
+    session.capacity = 16;
+    session.chunks = (rpng_chunk *)RPNG_CALLOC(session.capacity, sizeof(rpng_chunk));
+
+    const unsigned char *buffer_ptr = (const unsigned char *)buffer + 8;     // Move pointer after signature
+    const unsigned char *buffer_end = (const unsigned char *)buffer + size;
+    bool end_found = false;
+
+    while (!end_found && ((buffer_end - buffer_ptr) >= 12))
+    {
+        unsigned int chunk_size = ((unsigned int)buffer_ptr[0] << 24) | ((unsigned int)buffer_ptr[1] << 16) | ((unsigned int)buffer_ptr[2] << 8) | (unsigned int)buffer_ptr[3];
+
+        if ((unsigned int)(buffer_end - buffer_ptr - 12) < chunk_size)
+        {
+            RPNG_LOG("WARNING: PNG chunk exceeds buffer size, data could be truncated\n");
+            break;
+        }
+
+        if (session.count >= session.capacity)
+        {
+            session.capacity *= 2;
+            session.chunks = (rpng_chunk *)RPNG_REALLOC(session.chunks, session.capacity*sizeof(rpng_chunk));
+        }
+
+        rpng_chunk *chunk = &session.chunks[session.count];
+        chunk->length = (int)chunk_size;
+        memcpy(chunk->type, buffer_ptr + 4, 4);
+        chunk->data = (unsigned char *)RPNG_MALLOC((chunk_size > 0)? chunk_size : 1);
+        memcpy(chunk->data, buffer_ptr + 8, chunk_size);
+        chunk->crc = ((unsigned int)buffer_ptr[8 + chunk_size] << 24) | ((unsigned int)buffer_ptr[8 + chunk_size + 1] << 16) |
+                     ((unsigned int)buffer_ptr[8 + chunk_size + 2] << 8) | (unsigned int)buffer_ptr[8 + chunk_size + 3];
+        session.count++;
+
+        if (memcmp(chunk->type, "IEND", 4) == 0) end_found = true;
+
+        buffer_ptr += (4 + 4 + chunk_size + 4);     // Move pointer to next chunk
+    }
+
+    // Session requires IHDR first and IEND last
+    if (!end_found || (memcmp(session.chunks[0].type, "IHDR", 4) != 0))
+    {
+        RPNG_LOG("WARNING: PNG chunks not valid, session could not be loaded\n");
+        rpng_session_unload(&session);
+    }
+
+    return session;
+}
+
+// Unload session chunks
+void rpng_session_unload(rpng_session *session)
+{
+    if (session->chunks != NULL)
+    {
+        for (int i = 0; i < session->count; i++) RPNG_FREE(session->chunks[i].data);
+        RPNG_FREE(session->chunks);
+    }
+
+    session->chunks = NULL;
+    session->count = 0;
+    session->capacity = 0;
+}
+
+// Save session chunks to PNG file
+// NOTE: All session edits are committed with a single file write
+bool rpng_session_save(rpng_session *session, const char *filename)
+{
+    bool result = false;
+
+    int file_output_size = 0;
+    char *file_output = rpng_session_save_to_memory(session, &file_output_size);
+
+    if ((file_output != NULL) && (file_output_size > 0))
+    {
+        save_file_from_buffer(filename, file_output, file_output_size);
+        result = true;
+    }
+    else RPNG_LOG("WARNING: Failed to save file, session not valid\n");
+
+    RPNG_FREE(file_output);
+
+    return result;
+}
+
+// Save session chunks to memory buffer
+// NOTE: Output buffer is allocated with the exact required size
+char *rpng_session_save_to_memory(rpng_session *session, int *output_size)
+{
+    char *output_buffer = NULL;
+    int output_buffer_size = 0;
+
+    if ((session->chunks != NULL) && (session->count > 0))
+    {
+        int required_size = 8;
+        for (int i = 0; i < session->count; i++) required_size += (4 + 4 + session->chunks[i].length + 4);
+
+        output_buffer = (char *)RPNG_MALLOC(required_size);
+
+        memcpy(output_buffer, png_signature, 8);        // Copy PNG signature
+        output_buffer_size += 8;
+
+        for (int i = 0; i < session->count; i++)
+        {
+            rpng_chunk *chunk = &session->chunks[i];
+
+            unsigned int length_be = swap_endian(chunk->length);
+            unsigned int crc_be = swap_endian(chunk->crc);
+
+            memcpy(output_buffer + output_buffer_size, &length_be, 4);                     // Write chunk length
+            memcpy(output_buffer + output_buffer_size + 4, chunk->type, 4);                // Write chunk type
+            memcpy(output_buffer + output_buffer_size + 4 + 4, chunk->data, chunk->length);    // Write chunk data
+            memcpy(output_buffer + output_buffer_size + 4 + 4 + chunk->length, &crc_be, 4);    // Write CRC32
+            output_buffer_size += (4 + 4 + chunk->length + 4);
+        }
+    }
+
+    *output_size = output_buffer_size;
+    return output_buffer;
+}
+
+// Write one new chunk after IHDR (any kind)
+// NOTE: Chunk data is copied into session, CRC is computed over type + data
+void rpng_session_chunk_write(rpng_session *session, rpng_chunk chunk)
+{
+    if ((session->chunks == NULL) || (session->count < 2)) return;
+
+    if (session->count >= session->capacity)
+    {
+        session->capacity *= 2;
+        session->chunks = (rpng_chunk *)RPNG_REALLOC(session->chunks, session->capacity*sizeof(rpng_chunk));
+    }
+
+    // Move all chunks after IHDR one position
+    memmove(&session->chunks[2], &session->chunks[1], (session->count - 1)*sizeof(rpng_chunk));
+    session->count++;
+
+    rpng_chunk *new_chunk = &session->chunks[1];
+    new_chunk->length = chunk.length;
+    memcpy(new_chunk->type, chunk.type, 4);
+    new_chunk->data = (unsigned char *)RPNG_MALLOC((chunk.length > 0)? chunk.length : 1);
+    memcpy(new_chunk->data, chunk.data, chunk.length);
+    new_chunk->crc = compute_chunk_crc32(chunk.type, chunk.data, chunk.length);
+}
+
+// Remove one chunk type (all chunks of that type)
+void rpng_session_chunk_remove(rpng_session *session, const char *chunk_type)
+{
+    int count = 0;
+
+    for (int i = 0; i < session->count; i++)
+    {
+        if (memcmp(session->chunks[i].type, chunk_type, 4) == 0) RPNG_FREE(session->chunks[i].data);
+        else session->chunks[count++] = session->chunks[i];
+    }
+
+    session->count = count;
+}
+
+// Remove all chunks except: IHDR-PLTE-IDAT-IEND
+// NOTE: tRNS is preserved if PLTE is present
+void rpng_session_chunk_remove_ancillary(rpng_session *session)
+{
+    bool preserve_palette_transparency = false;
+    int count = 0;
+
+    for (int i = 0; i < session->count; i++)
+    {
+        rpng_chunk *chunk = &session->chunks[i];
+
+        if (memcmp(chunk->type, "PLTE", 4) == 0) preserve_palette_transparency = true;
+
+        if ((memcmp(chunk->type, "IHDR", 4) == 0) ||
+            (memcmp(chunk->type, "PLTE", 4) == 0) ||
+            (memcmp(chunk->type, "IDAT", 4) == 0) ||
+            (memcmp(chunk->type, "IEND", 4) == 0) ||
+            (preserve_palette_transparency && (memcmp(chunk->type, "tRNS", 4) == 0)))
+        {
+            session->chunks[count++] = *chunk;
+        }
+        else RPNG_FREE(chunk->data);
+    }
+
+    session->count = count;
+}
+
+// Write tEXt chunk to session
+void rpng_session_chunk_write_text(rpng_session *session, char *keyword, char *text)
+{
+    rpng_chunk chunk = gen_chunk_text(keyword, text);
+    rpng_session_chunk_write(session, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Write zTXt chunk to session, DEFLATE compressed text
+void rpng_session_chunk_write_comp_text(rpng_session *session, char *keyword, char *text)
+{
+    rpng_chunk chunk = gen_chunk_comp_text(keyword, text);
+    rpng_session_chunk_write(session, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Write gAMA chunk to session
+void rpng_session_chunk_write_gamma(rpng_session *session, float gamma)
+{
+    rpng_chunk chunk = gen_chunk_gamma(gamma);
+    rpng_session_chunk_write(session, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Write sRGB chunk to session, requires gAMA chunk
+void rpng_session_chunk_write_srgb(rpng_session *session, char srgb_type)
+{
+    rpng_chunk chunk = gen_chunk_srgb(srgb_type);
+    rpng_session_chunk_write(session, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Write tIME chunk to session
+void rpng_session_chunk_write_time(rpng_session *session, short year, char month, char day, char hour, char min, char sec)
+{
+    rpng_chunk chunk = gen_chunk_time(year, month, day, hour, min, sec);
+    rpng_session_chunk_write(session, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Write pHYs chunk to session
+void rpng_session_chunk_write_physical_size(rpng_session *session, int pixels_unit_x, int pixels_unit_y, bool meters)
+{
+    rpng_chunk chunk = gen_chunk_physical_size(pixels_unit_x, pixels_unit_y, meters);
+    rpng_session_chunk_write(session, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Write cHRM chunk to session
+void rpng_session_chunk_write_chroma(rpng_session *session, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
+{
+    rpng_chunk chunk = gen_chunk_chroma(white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y);
+    rpng_session_chunk_write(session, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Filter scanline with provided filter type, returns sum of absolute differences
+// NOTE: Output bytes are considered signed differences for the sum, used on adaptive filter selection
+// REF: https://www.w3.org/TR/PNG/#9Filters
+static int filter_scanline(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter)
+{
+    int sum = 0;
+
+    // NOTE: Bytes of first pixel have no left neighbour (a = 0, c = 0)
+    switch (filter)
+    {
+        case 0: memcpy(output, scanline, scanline_size); break;
+        case 1:
+        {
+            for (int p = 0; p < pixel_size; p++) output[p] = scanline[p];
+            for (int p = pixel_size; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] - scanline[p - pixel_size]);
+        } break;
+        case 2:
+        {
+            for (int p = 0; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] - prev_scanline[p]);
+        } break;
+        case 3:
+        {
+            for (int p = 0; p < pixel_size; p++) output[p] = (unsigned char)(scanline[p] - (prev_scanline[p] >> 1));
+            for (int p = pixel_size; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] - ((scanline[p - pixel_size] + prev_scanline[p]) >> 1));
+        } break;
+        case 4:
+        {
+            for (int p = 0; p < pixel_size; p++) output[p] = (unsigned char)(scanline[p] - prev_scanline[p]);
+            for (int p = pixel_size; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] - rpng_paeth_predictor(scanline[p - pixel_size], prev_scanline[p], prev_scanline[p - pixel_size]));
+        } break;
+        default: break;
+    }
+
+    for (int p = 0; p < scanline_size; p++) sum += abs((signed char)output[p]);
+
+    return sum;
+}
+
+// Reverse scanline filter with provided filter type
+// NOTE: Output can overlap scanline if output is placed before it (in place unfiltering),
+// every scanline byte is read before its position is written, unknown filter types are considered None
+static void unfilter_scanline(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter)
+{
+    // SIMD code paths: Sub, Average and Paeth for 3 or 4 bytes pixels (8 bit RGB/RGBA, 16 bit GrayAlpha), Up for any pixel size
+    // NOTE: Filters operate on bytes, pixel size (not channels meaning) defines left neighbour byte distance
+    bool simd_supported = ((filter >= 1) && (filter <= 4)) && ((filter == 2) || (pixel_size == 3) || (pixel_size == 4));
+
+#if defined(RPNG_UNFILTER_SSE2)
+    int sse2_state = RPNG_ATOMIC_LOAD(&unfilter_sse2_state);
+    if (sse2_state == 0) sse2_state = init_unfilter_sse2();
+    if (simd_supported && (sse2_state == 2)) { unfilter_scanline_sse2(output, scanline, prev_scanline, scanline_size, pixel_size, filter); return; }
+#elif defined(RPNG_UNFILTER_NEON)
+    if (simd_supported) { unfilter_scanline_neon(output, scanline, prev_scanline, scanline_size, pixel_size, filter); return; }
+#else
+    (void)simd_supported;
+#endif
+
+    // NOTE: Bytes of first pixel have no left neighbour (a = 0, c = 0)
+    switch (filter)
+    {
+        case 1:
+        {
+            for (int p = 0; p < pixel_size; p++) output[p] = scanline[p];
+            for (int p = pixel_size; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] + output[p - pixel_size]);
+        } break;
+        case 2:
+        {
+            for (int p = 0; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] + prev_scanline[p]);
+        } break;
+        case 3:
+        {
+            for (int p = 0; p < pixel_size; p++) output[p] = (unsigned char)(scanline[p] + (prev_scanline[p] >> 1));
+            for (int p = pixel_size; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] + ((output[p - pixel_size] + prev_scanline[p]) >> 1));
+        } break;
+        case 4:
+        {
+            for (int p = 0; p < pixel_size; p++) output[p] = (unsigned char)(scanline[p] + prev_scanline[p]);
+            for (int p = pixel_size; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] + rpng_paeth_predictor(output[p - pixel_size], prev_scanline[p], prev_scanline[p - pixel_size]));
+        } break;
+        default: memmove(output, scanline, scanline_size); break;
+    }
+}
+
+#if defined(RPNG_UNFILTER_SSE2)
+// Detect CPU SSE2 support (always available on x64), returns detection state
+// NOTE: Detection result is a single value published atomically, concurrent detections store the same value
+static int init_unfilter_sse2(void)
+{
+    bool supported = false;
+
+#if defined(__x86_64__) || defined(_M_X64)
+    supported = true;
+#elif defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 1);
+    supported = ((info[3] & (1 << 26)) != 0);
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) supported = ((edx & (1 << 26)) != 0);
+#endif
+
+    int state = supported? 2 : 1;
+    RPNG_ATOMIC_STORE(&unfilter_sse2_state, state);
+
+    return state;
+}
+
+// Load pixel bytes (3 or 4) into register low bytes
+RPNG_TARGET_SSE2 static __m128i load_pixel_sse2(const unsigned char *pixel, int pixel_size)
+{
+    unsigned int value = 0;
+    if (pixel_size == 4) memcpy(&value, pixel, 4);
+    else value = (unsigned int)pixel[0] | ((unsigned int)pixel[1] << 8) | ((unsigned int)pixel[2] << 16);
+    return _mm_cvtsi32_si128((int)value);
+}
+
+// Store register low bytes into pixel bytes (3 or 4)
+RPNG_TARGET_SSE2 static void store_pixel_sse2(unsigned char *pixel, __m128i value, int pixel_size)
+{
+    unsigned int bytes = (unsigned int)_mm_cvtsi128_si32(value);
+    if (pixel_size == 4) memcpy(pixel, &bytes, 4);
+    else { pixel[0] = (unsigned char)bytes; pixel[1] = (unsigned char)(bytes >> 8); pixel[2] = (unsigned char)(bytes >> 16); }
+}
+
+// Reverse scanline filter using SSE2, one pixel per iteration (Up filter, 16 bytes per iteration)
+// NOTE: Pixel bytes are read before output is written, so in place unfiltering is supported
+// REF: libpng, contrib/intel/filter_sse2_intrinsics.c
+RPNG_TARGET_SSE2 static void unfilter_scanline_sse2(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a = zero, b = zero, c = zero, d = zero;
+
+    switch (filter)
+    {
+        case 1:     // Sub: x + a
+        {
+            for (int p = 0; p < scanline_size; p += pixel_size)
+            {
+                d = _mm_add_epi8(load_pixel_sse2(scanline + p, pixel_size), d);
+                store_pixel_sse2(output + p, d, pixel_size);
+            }
+        } break;
+        case 2:     // Up: x + b
+        {
+            int p = 0;
+            for (; (p + 16) <= scanline_size; p += 16)
+            {
+                d = _mm_add_epi8(_mm_loadu_si128((const __m128i *)(scanline + p)), _mm_loadu_si128((const __m128i *)(prev_scanline + p)));
+                _mm_storeu_si128((__m128i *)(output + p), d);
+            }
+            for (; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] + prev_scanline[p]);
+        } break;
+        case 3:     // Average: x + (a + b)/2
+        {
+            for (int p = 0; p < scanline_size; p += pixel_size)
+            {
+                b = load_pixel_sse2(prev_scanline + p, pixel_size);
+                a = d;
+
+                // NOTE: _mm_avg_epu8() rounds up, rounding bit is removed to get floor((a + b)/2)
+                __m128i avg = _mm_avg_epu8(a, b);
+                avg = _mm_sub_epi8(avg, _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+
+                d = _mm_add_epi8(load_pixel_sse2(scanline + p, pixel_size), avg);
+                store_pixel_sse2(output + p, d, pixel_size);
+            }
+        } break;
+        case 4:     // Paeth: x + paeth(a, b, c)
+        {
+            // NOTE: Predictor is computed with 16 bit values to avoid overflow
+            for (int p = 0; p < scanline_size; p += pixel_size)
+            {
+                c = b;
+                b = _mm_unpacklo_epi8(load_pixel_sse2(prev_scanline + p, pixel_size), zero);
+                a = d;
+                d = _mm_unpacklo_epi8(load_pixel_sse2(scanline + p, pixel_size), zero);
+
+                __m128i pa = _mm_sub_epi16(b, c);       // p - a = b - c
+                __m128i pb = _mm_sub_epi16(a, c);       // p - b = a - c
+                __m128i pc = _mm_add_epi16(pa, pb);     // p - c = (b - c) + (a - c)
+
+                pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+                pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+                pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+                // Paeth breaks ties favoring a over b over c
+                __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+                __m128i mask_a = _mm_cmpeq_epi16(smallest, pa);
+                __m128i mask_b = _mm_cmpeq_epi16(smallest, pb);
+                __m128i nearest = _mm_or_si128(_mm_and_si128(mask_b, b), _mm_andnot_si128(mask_b, c));
+                nearest = _mm_or_si128(_mm_and_si128(mask_a, a), _mm_andnot_si128(mask_a, nearest));
+
+                // NOTE: Bytes addition, result wraps modulo 256 and high bytes remain zero
+                d = _mm_add_epi8(d, nearest);
+                store_pixel_sse2(output + p, _mm_packus_epi16(d, d), pixel_size);
+            }
+        } break;
+        default: break;
+    }
+}
+#endif
+
+#if defined(RPNG_UNFILTER_NEON)
+// Load pixel bytes (3 or 4) into register low bytes
+static uint8x8_t load_pixel_neon(const unsigned char *pixel, int pixel_size)
+{
+    unsigned int value = 0;
+    if (pixel_size == 4) memcpy(&value, pixel, 4);
+    else value = (unsigned int)pixel[0] | ((unsigned int)pixel[1] << 8) | ((unsigned int)pixel[2] << 16);
+    return vreinterpret_u8_u32(vdup_n_u32(value));
+}
+
+// Store register low bytes into pixel bytes (3 or 4)
+static void store_pixel_neon(unsigned char *pixel, uint8x8_t value, int pixel_size)
+{
+    unsigned int bytes = vget_lane_u32(vreinterpret_u32_u8(value), 0);
+    if (pixel_size == 4) memcpy(pixel, &bytes, 4);
+    else { pixel[0] = (unsigned char)bytes; pixel[1] = (unsigned char)(bytes >> 8); pixel[2] = (unsigned char)(bytes >> 16); }
+}
+
+// Reverse scanline filter using NEON, one pixel per iteration (Up filter, 16 bytes per iteration)
+// NOTE: Pixel bytes are read before output is written, so in place unfiltering is supported
+// REF: libpng, arm/filter_neon_intrinsics.c
+static void unfilter_scanline_neon(unsigned char *output, const unsigned char *scanline, const unsigned char *prev_scanline, int scanline_size, int pixel_size, int filter)
+{
+    uint8x8_t a = vdup_n_u8(0), b = vdup_n_u8(0), c = vdup_n_u8(0), d = vdup_n_u8(0);
+
+    switch (filter)
+    {
+        case 1:     // Sub: x + a
+        {
+            for (int p = 0; p < scanline_size; p += pixel_size)
+            {
+                d = vadd_u8(load_pixel_neon(scanline + p, pixel_size), d);
+                store_pixel_neon(output + p, d, pixel_size);
+            }
+        } break;
+        case 2:     // Up: x + b
+        {
+            int p = 0;
+            for (; (p + 16) <= scanline_size; p += 16) vst1q_u8(output + p, vaddq_u8(vld1q_u8(scanline + p), vld1q_u8(prev_scanline + p)));
+            for (; p < scanline_size; p++) output[p] = (unsigned char)(scanline[p] + prev_scanline[p]);
+        } break;
+        case 3:     // Average: x + (a + b)/2
+        {
+            for (int p = 0; p < scanline_size; p += pixel_size)
+            {
+                b = load_pixel_neon(prev_scanline + p, pixel_size);
+                d = vadd_u8(load_pixel_neon(scanline + p, pixel_size), vhadd_u8(d, b));
+                store_pixel_neon(output + p, d, pixel_size);
+            }
+        } break;
+        case 4:     // Paeth: x + paeth(a, b, c)
+        {
+            for (int p = 0; p < scanline_size; p += pixel_size)
+            {
+                c = b;
+                b = load_pixel_neon(prev_scanline + p, pixel_size);
+                a = d;
+
+                uint16x8_t pa = vabdl_u8(b, c);                                 // |p - a| = |b - c|
+                uint16x8_t pb = vabdl_u8(a, c);                                 // |p - b| = |a - c|
+                uint16x8_t pc = vabdq_u16(vaddl_u8(a, b), vaddl_u8(c, c));      // |p - c| = |a + b - 2c|
+
+                // Paeth breaks ties favoring a over b over c
+                uint8x8_t use_a = vmovn_u16(vandq_u16(vcleq_u16(pa, pb), vcleq_u16(pa, pc)));
+                uint8x8_t use_b = vmovn_u16(vcleq_u16(pb, pc));
+                uint8x8_t nearest = vbsl_u8(use_a, a, vbsl_u8(use_b, b, c));
+
+                d = vadd_u8(load_pixel_neon(scanline + p, pixel_size), nearest);
+                store_pixel_neon(output + p, d, pixel_size);
+            }
+        } break;
+        default: break;
+    }
+}
+#endif
+
+// Read image info from IHDR and concatenate all IDAT chunks data as a single zlib stream
+// NOTE: IDAT chunks can split the stream at any point, CRC is verified for every chunk
+static unsigned char *load_image_data_compressed(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth, int *comp_data_size)
+{
+    const unsigned char *buffer_ptr = (const unsigned char *)buffer;
+
+    if ((buffer_ptr == NULL) || (memcmp(buffer_ptr, png_signature, 8) != 0)) return NULL;
+    buffer_ptr += 8;    // Move pointer after signature
+
+    // First chunk is always IHDR, we can check image data info
+    if ((swap_endian(((unsigned int *)buffer_ptr)[0]) != 13) || (memcmp(buffer_ptr + 4, "IHDR", 4) != 0)) return NULL;
+
+    rpng_chunk_IHDR *IHDRData = (rpng_chunk_IHDR *)(buffer_ptr + 8);
+
+    *width = swap_endian(IHDRData->width);      // Image width
+    *height = swap_endian(IHDRData->height);    // Image height
+    *bit_depth = IHDRData->bit_depth;           // Bit depth
+
+    *color_channels = 0;
+    switch (IHDRData->color_type)
+    {
+        case 0: *color_channels = 1; break;     // Pixel format: 0-Grayscale
+        case 4: *color_channels = 2; break;     // Pixel format: 4-GrayAlpha
+        case 2: *color_channels = 3; break;     // Pixel format: 2-RGB
+        case 6: *color_channels = 4; break;     // Pixel format: 6-RGBA
+        case 3: *color_channels = 0; break;     // Pixel format: 3-Indexed  (Not supported)
+        default: break;
+    }
+
+    if ((*color_channels == 0) || ((*bit_depth != 8) && (*bit_depth != 16)))
+    {
+        RPNG_LOG("WARNING: Failed to load file, image pixel format not supported\n");
+        return NULL;
+    }
+
+    // Additional info provided by IHDR (in case it was required)
+    //IHDRData->compression;        // Compression method: 0 (DEFLATE)
+    //IHDRData->filter;             // Filter method: 0 (default)
+    //IHDRData->interlace;          // Interlace scheme (optional): 0 (none)
+
+    // Concatenate all IDAT chunks data, CRC is verified for every chunk
+    // NOTE: There can be multiple IDAT chunks; if so, they must appear
+    // consecutively with no other intervening chunks (not checked)
+    unsigned char *comp_data = NULL;
+    int comp_data_capacity = 0;
+    bool valid = true;
+
+    *comp_data_size = 0;
+
+    while (memcmp(buffer_ptr + 4, "IEND", 4) != 0)  // While IEND chunk not reached
+    {
+        int chunk_size = (int)swap_endian(((unsigned int *)buffer_ptr)[0]);
+
+        if (memcmp(buffer_ptr + 4, "IDAT", 4) == 0)     // Check IDAT chunk: image data
+        {
+            unsigned int crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
+
+            if (compute_chunk_crc32(buffer_ptr + 4, buffer_ptr + 8, chunk_size) != crc)
+            {
+                RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
+                valid = false;
+                break;
+            }
+
+            if ((*comp_data_size + chunk_size) > comp_data_capacity)
+            {
+                int capacity = (comp_data_capacity > 0)? 2*comp_data_capacity : chunk_size;
+                if (capacity < (*comp_data_size + chunk_size)) capacity = *comp_data_size + chunk_size;
+
+                // NOTE: sinfl reads input 8 bytes at a time ahead of decoding position, padding avoids reading out of bounds
+                unsigned char *comp_data_resized = (unsigned char *)RPNG_REALLOC(comp_data, capacity + 16);
+                if (comp_data_resized == NULL) { valid = false; break; }
+
+                comp_data = comp_data_resized;
+                comp_data_capacity = capacity;
+            }
+
+            memcpy(comp_data + *comp_data_size, buffer_ptr + 8, chunk_size);
+            *comp_data_size += chunk_size;
+            memset(comp_data + *comp_data_size, 0, 16);
+        }
+
+        buffer_ptr += (4 + 4 + chunk_size + 4);     // Move pointer to next chunk
+    }
+
+    if (!valid || (*comp_data_size == 0))
+    {
+        RPNG_FREE(comp_data);
+        comp_data = NULL;
+        *comp_data_size = 0;
+    }
+
+    return comp_data;
+}
+
+// Read image info from IHDR and decompress all IDAT chunks data as a single zlib stream
+// NOTE: IDAT chunks are concatenated before decompression, so chunks can split the stream at any point,
+// returned data contains every scanline preceded by its filter type byte: height*(1 + scanline_size)
+static unsigned char *load_image_data_filtered(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    unsigned char *data = NULL;
+    int comp_data_size = 0;
+    unsigned char *comp_data = load_image_data_compressed(buffer, width, height, color_channels, bit_depth, &comp_data_size);
+
+    if (comp_data != NULL)
+    {
+        // Decompress image data, every scanline was originally filtered for maximum compression
+        // and one extra byte with the filter type was added to every scanline
+        int data_size = (*height)*(1 + (*width)*(*color_channels)*(*bit_depth/8));
+        data = (unsigned char *)RPNG_MALLOC(data_size);
+
+        int data_decomp_size = (data != NULL)? zsinflate(data, data_size, comp_data, comp_data_size) : 0;
+
+        RPNG_LOG("INFO: IDAT data decompressed: %i -> %i\n", comp_data_size, data_decomp_size);
+
+        if (data_decomp_size != data_size)
+        {
+            RPNG_LOG("WARNING: IDAT image data decompression failed\n");
+            RPNG_FREE(data);
+            data = NULL;
+        }
+    }
+
+    RPNG_FREE(comp_data);
+
+    return data;
+}
+
+// Swap integer from big<->little endian
+static unsigned int swap_endian(unsigned int value)
+{
+    // Swap endian (big to little) or (little to big)
+    unsigned int b0, b1, b2, b3;
+    unsigned int res;
+
+    b0 = (value & 0x000000ff) << 24u;
+    b1 = (value & 0x0000ff00) << 8u;
+    b2 = (value & 0x00ff0000) >> 8u;
+    b3 = (value & 0xff000000) >> 24u;
+
+    res = b0 | b1 | b2 | b3;
+
+    return res;
+}
+
+// CRC32 slicing-by-8 tables (reflected polynomial 0xEDB88320)
+// NOTE: crc_tables[0] is the standard byte-wise table, crc_tables[k] advances a byte k positions,
+// tables are constant (no initialization required), so CRC32 can be computed from any thread
+static const unsigned int crc_tables[8][256] = {
+    {
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+    },
+    {
+        0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+        0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+        0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+        0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+        0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+        0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+        0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+        0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+        0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+        0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+        0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+        0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+        0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+        0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+        0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+        0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+        0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+        0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+        0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 0x271b2d9c, 0x3e001cdd,
+        0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+        0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+        0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+        0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+        0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+        0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+        0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+        0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+        0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x06a0d9d0,
+        0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b,
+        0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+        0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+        0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72
+    },
+    {
+        0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 0x048d7cb2, 0x054f1685,
+        0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d,
+        0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+        0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+        0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+        0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+        0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+        0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+        0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+        0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+        0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+        0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+        0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+        0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+        0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+        0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+        0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+        0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+        0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+        0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+        0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+        0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+        0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+        0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+        0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+        0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+        0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+        0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+        0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+        0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+        0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+        0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed
+    },
+    {
+        0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+        0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+        0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+        0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x087a47c9,
+        0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+        0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+        0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+        0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7,
+        0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+        0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+        0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+        0x0eb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+        0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 0x1e4da8df, 0xa6f1cfba,
+        0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+        0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+        0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+        0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+        0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+        0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+        0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+        0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+        0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+        0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+        0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+        0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+        0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+        0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+        0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+        0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+        0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+        0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+        0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1
+    },
+    {
+        0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+        0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+        0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+        0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+        0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314,
+        0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+        0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+        0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+        0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+        0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+        0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+        0x0863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+        0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+        0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+        0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+        0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 0x46e25eae, 0x7b82771e,
+        0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82,
+        0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+        0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+        0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+        0x70279f96, 0x4d47b626, 0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+        0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+        0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+        0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+        0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+        0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+        0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+        0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 0x36c5c138, 0x0ba5e888,
+        0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+        0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+        0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+        0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c
+    },
+    {
+        0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+        0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+        0x03d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+        0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+        0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+        0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+        0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+        0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+        0x0f580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+        0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+        0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+        0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+        0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+        0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+        0x0b220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+        0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+        0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460,
+        0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+        0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x006326fb,
+        0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+        0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+        0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+        0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd,
+        0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+        0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0x0ced2e0c,
+        0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+        0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+        0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+        0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a,
+        0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+        0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x089729a1,
+        0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc
+    },
+    {
+        0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+        0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+        0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+        0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 0x37e1e793, 0x9196ec27,
+        0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712,
+        0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+        0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+        0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+        0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+        0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+        0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+        0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+        0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+        0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+        0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+        0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+        0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+        0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+        0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+        0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+        0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+        0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+        0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+        0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+        0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x09baa105,
+        0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+        0xabc30345, 0x0db408f1, 0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+        0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+        0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+        0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+        0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 0x07ae0fe3, 0xa1d90457,
+        0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30
+    },
+    {
+        0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 0xc66f0987, 0x0ac50919,
+        0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+        0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+        0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+        0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+        0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+        0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+        0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+        0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+        0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+        0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+        0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+        0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+        0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217,
+        0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+        0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+        0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+        0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+        0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+        0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+        0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+        0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+        0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+        0x0513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+        0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+        0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+        0x061d761c, 0xcab77682, 0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+        0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+        0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+        0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+        0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+        0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6
+    }
+};
+
+#if defined(RPNG_CRC32_CLMUL)
+// CPU carry-less multiply support state: 0-Not detected yet, 1-Not supported, 2-Supported
+// NOTE: Detection result is a single value published atomically, concurrent detections store the same value
+static int crc_clmul_state = 0;
+
+// Detect CPU carry-less multiply support (PCLMULQDQ + SSE2), returns detection state
+static int init_crc32_clmul(void)
+{
+    bool supported = false;
+
+#if defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 1);
+    supported = ((info[2] & (1 << 1)) != 0) && ((info[3] & (1 << 26)) != 0);
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) supported = ((ecx & (1 << 1)) != 0) && ((edx & (1 << 26)) != 0);
+#endif
+
+    int state = supported? 2 : 1;
+    RPNG_ATOMIC_STORE(&crc_clmul_state, state);
+
+    return state;
+}
+#endif
+
+#if defined(RPNG_CRC32_CLMUL)
+// Update CRC32 state (not inverted) using carry-less multiply folding
+// NOTE: Size must be a multiple of 16 and at least 64 bytes
+// REF: Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+RPNG_TARGET_CLMUL static unsigned int update_crc32_clmul(unsigned int crc, const unsigned char *buffer, int size)
+{
+    // Folding constants for reflected polynomial 0xEDB88320
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);     // Fold by 4 (512 bits)
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);     // Fold by 1 (128 bits)
+    const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124LL);                  // Fold 96 to 64 bits
+    const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);     // Barrett reduction: polynomial, mu
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(buffer + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buffer + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buffer + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buffer + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    buffer += 64;
+    size -= 64;
+
+    // Fold 4 lanes in parallel, 64 bytes per iteration
+    while (size >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(buffer + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(buffer + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(buffer + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(buffer + 0x30)));
+        buffer += 64;
+        size -= 64;
+    }
+
+    // Fold 4 lanes into 1 lane (128 bits)
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold remaining 16 bytes blocks
+    while (size >= 16)
+    {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)buffer)), x5);
+        buffer += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_srli_si128(x1, 4);
+
+    return (unsigned int)_mm_cvtsi128_si32(x0);
+}
+#endif
+
+// Update CRC32 with new data, CRC32 of concatenated buffers can be computed by parts
+// NOTE: Carry-less multiply path is used for big buffers if supported, slicing-by-8 otherwise
+static unsigned int update_crc32(unsigned int crc, const unsigned char *buffer, int size)
+{
+    crc = ~crc;
+
+#if defined(RPNG_CRC32_CLMUL)
+    int clmul_state = RPNG_ATOMIC_LOAD(&crc_clmul_state);
+    if (clmul_state == 0) clmul_state = init_crc32_clmul();
+
+    if ((clmul_state == 2) && (size >= 64))
+    {
+        int clmul_size = size & ~15;
+
+        crc = update_crc32_clmul(crc, buffer, clmul_size);
+        buffer += clmul_size;
+        size -= clmul_size;
+    }
+#endif
+
+    // Slicing-by-8: 8 bytes per iteration, 8 independent table lookups
+    // NOTE: Bytes are combined in little-endian order, portable across platforms endianness
+    while (size >= 8)
+    {
+        unsigned int one = crc ^ ((unsigned int)buffer[0] | ((unsigned int)buffer[1] << 8) | ((unsigned int)buffer[2] << 16) | ((unsigned int)buffer[3] << 24));
+        unsigned int two = (unsigned int)buffer[4] | ((unsigned int)buffer[5] << 8) | ((unsigned int)buffer[6] << 16) | ((unsigned int)buffer[7] << 24);
+
+        crc = crc_tables[7][one & 0xff] ^ crc_tables[6][(one >> 8) & 0xff] ^ crc_tables[5][(one >> 16) & 0xff] ^ crc_tables[4][one >> 24] ^
+              crc_tables[3][two & 0xff] ^ crc_tables[2][(two >> 8) & 0xff] ^ crc_tables[1][(two >> 16) & 0xff] ^ crc_tables[0][two >> 24];
+
+        buffer += 8;
+        size -= 8;
+    }
+
+    for (int i = 0; i < size; i++) crc = (crc >> 8) ^ crc_tables[0][buffer[i] ^ (crc & 0xff)];
+
+    return ~crc;
+}
+
+// Compute CRC32
+static unsigned int compute_crc32(unsigned char *buffer, int size)
+{
+    return update_crc32(0, buffer, size);
+}
+
+// Compute chunk CRC32 (type + data)
+// NOTE: No temporal buffer is required to concatenate chunk type and data
+static unsigned int compute_chunk_crc32(const unsigned char *type, const unsigned char *data, int length)
+{
+    unsigned int crc = update_crc32(0, type, 4);
+
+    if (length > 0) crc = update_crc32(crc, data, length);
+
+    return crc;
+}
+
+#if defined(RPNG_PARALLEL_DEFLATE_SUPPORT)
+// Compress data into zlib stream using multiple threads
+// NOTE: Data is split in independent blocks (no shared window), every block is compressed into
+// byte aligned non-final deflate blocks, then blocks are concatenated into a single zlib stream
+// REF: https://zlib.net/pigz/
+static unsigned char *zdeflate_parallel(const unsigned char *data, int size, int *comp_size)
+{
+    unsigned char *comp_data = NULL;
+    deflate_pool pool = { 0 };
+
+    pool.count = (size + RPNG_PARALLEL_DEFLATE_BLOCK_SIZE - 1)/RPNG_PARALLEL_DEFLATE_BLOCK_SIZE;
+    pool.blocks = (deflate_block *)RPNG_CALLOC(pool.count, sizeof(deflate_block));
+    if (pool.blocks == NULL) return NULL;
+
+    for (int i = 0; i < pool.count; i++)
+    {
+        pool.blocks[i].data = data + i*RPNG_PARALLEL_DEFLATE_BLOCK_SIZE;
+        pool.blocks[i].size = ((size - i*RPNG_PARALLEL_DEFLATE_BLOCK_SIZE) < RPNG_PARALLEL_DEFLATE_BLOCK_SIZE)? (size - i*RPNG_PARALLEL_DEFLATE_BLOCK_SIZE) : RPNG_PARALLEL_DEFLATE_BLOCK_SIZE;
+        pool.blocks[i].last = (i == (pool.count - 1));
+    }
+
+    pthread_mutex_init(&pool.mutex, NULL);
+
+    // Create worker threads, caller thread also compresses blocks
+    pthread_t workers[RPNG_PARALLEL_DEFLATE_THREADS] = { 0 };
+    int workers_count = 0;
+
+    for (int i = 0; (i < (RPNG_PARALLEL_DEFLATE_THREADS - 1)) && (i < (pool.count - 1)); i++)
+    {
+        if (pthread_create(&workers[workers_count], NULL, deflate_worker, &pool) == 0) workers_count++;
+    }
+
+    deflate_worker(&pool);
 
-                    memcpy(output_buffer + output_buffer_size, idata_split_buffer, split_size + 12);
-                    output_buffer_size += (split_size + 12);
-                }
+    for (int i = 0; i < workers_count; i++) pthread_join(workers[i], NULL);
+    pthread_mutex_destroy(&pool.mutex);
 
-                // Save last IDAT chunk piece
-                unsigned int chunk_remain_size_be = swap_endian(chunk_remain_size);
-                memcpy(idata_split_buffer, &chunk_remain_size_be, 4);
-                memcpy(idata_split_buffer + 4, "IDAT", 4);
-                memcpy(idata_split_buffer + 4 + 4, buffer_ptr_offset, chunk_remain_size);
-                unsigned int crc = compute_crc32((unsigned char *)(idata_split_buffer + 4), 4 + chunk_remain_size);
-                crc = swap_endian(crc);
-                memcpy(idata_split_buffer + 4 + 4 + chunk_remain_size, &crc, 4);
+    // Check all blocks have been compressed
+    int total_size = 2 + 4;     // zlib header + Adler-32
+    for (int i = 0; i < pool.count; i++)
+    {
+        if (pool.blocks[i].comp_data == NULL) { total_size = 0; break; }
+        total_size += pool.blocks[i].comp_size;
+    }
 
-                memcpy(output_buffer + output_buffer_size, idata_split_buffer, chunk_remain_size + 12);
-                output_buffer_size += (chunk_remain_size + 12);
-            }
-            else
-            {
-                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
-                output_buffer_size += (4 + 4 + chunk_size + 4);
-            }
+    if (total_size > 0) comp_data = (unsigned char *)RPNG_MALLOC(total_size);
 
-            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
-        }
+    if (comp_data != NULL)
+    {
+        comp_data[0] = 0x78;    // Deflate, 32K window
+        comp_data[1] = 0x01;    // Fast compression (same as sdefl)
+        *comp_size = 2;
 
-        RPNG_FREE(idata_split_buffer);
+        unsigned int adler = pool.blocks[0].adler;
 
-        // Write IEND chunk
-        memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + 4);
-        output_buffer_size += 12;
+        for (int i = 0; i < pool.count; i++)
+        {
+            memcpy(comp_data + *comp_size, pool.blocks[i].comp_data, pool.blocks[i].comp_size);
+            *comp_size += pool.blocks[i].comp_size;
 
-        // Resize output buffer
-        char *output_buffer_sized = (char *)RPNG_REALLOC(output_buffer, output_buffer_size);
-        if (output_buffer_sized != NULL) output_buffer = output_buffer_sized;
+            if (i > 0) adler = combine_adler32(adler, pool.blocks[i].adler, pool.blocks[i].size);
+        }
+
+        adler = swap_endian(adler);
+        memcpy(comp_data + *comp_size, &adler, 4);
+        *comp_size += 4;
     }
 
-    *output_size = output_buffer_size;
-    return output_buffer;
-}
+    for (int i = 0; i < pool.count; i++) RPNG_FREE(pool.blocks[i].comp_data);
+    RPNG_FREE(pool.blocks);
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+    return comp_data;
+}
 
-// Swap integer from big<->little endian
-static unsigned int swap_endian(unsigned int value)
+// Compress pool blocks until no block is left
+// NOTE: Every worker uses its own compressor state, blocks not compressed (allocation failed) keep comp_data = NULL
+static void *deflate_worker(void *arg)
 {
-    // Swap endian (big to little) or (little to big)
-    unsigned int b0, b1, b2, b3;
-    unsigned int res;
+    deflate_pool *pool = (deflate_pool *)arg;
+    struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
 
-    b0 = (value & 0x000000ff) << 24u;
-    b1 = (value & 0x0000ff00) << 8u;
-    b2 = (value & 0x00ff0000) >> 8u;
-    b3 = (value & 0xff000000) >> 24u;
+    while (sde != NULL)
+    {
+        pthread_mutex_lock(&pool->mutex);
+        int index = pool->next;
+        if (index < pool->count) pool->next++;
+        pthread_mutex_unlock(&pool->mutex);
 
-    res = b0 | b1 | b2 | b3;
+        if (index >= pool->count) break;
 
-    return res;
+        deflate_block *block = &pool->blocks[index];
+
+        // NOTE: Non-final blocks require 6 additional bytes for the trailing stored block
+        block->comp_data = (unsigned char *)RPNG_MALLOC(sdefl_bound(block->size) + 6);
+
+        if (block->comp_data != NULL)
+        {
+            block->comp_size = sdeflate_block(sde, block->comp_data, block->data, block->size, 8, block->last);
+            block->adler = sdefl_adler32(1, block->data, block->size);
+        }
+    }
+
+    RPNG_FREE(sde);
+
+    return NULL;
 }
 
-// Compute CRC32
-static unsigned int compute_crc32(unsigned char *buffer, int size)
+// Combine Adler-32 of two consecutive buffers, size2 is the second buffer size
+// REF: zlib adler32_combine()
+static unsigned int combine_adler32(unsigned int adler1, unsigned int adler2, unsigned int size2)
 {
-    static unsigned int crc_table[256] = {
-        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-        0x0eDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-    };
-
-    unsigned int crc = ~0u;
-
-    for (int i = 0; i < size; i++) crc = (crc >> 8) ^ crc_table[buffer[i] ^ (crc & 0xff)];
+    const unsigned int base = 65521;
+    unsigned int rem = size2%base;
+    unsigned int sum1 = adler1 & 0xffff;
+    unsigned int sum2 = (rem*sum1)%base;
 
-    return ~crc;
+    sum1 += (adler2 & 0xffff) + base - 1;
+    sum2 += (adler1 >> 16) + (adler2 >> 16) + base - rem;
+
+    if (sum1 >= base) sum1 -= base;
+    if (sum1 >= base) sum1 -= base;
+    if (sum2 >= (base << 1)) sum2 -= (base << 1);
+    if (sum2 >= base) sum2 -= base;
+
+    return (sum1 | (sum2 << 16));
 }
+#endif
 
 // Load data from file into a buffer
 static char *load_file_to_buffer(const char *filename, int *bytes_read)
@@ -1943,6 +3122,96 @@ static void save_file_from_buffer(const char *filename, void *data, int bytesToW
 #endif
 }
 
+// Read chunks from file, seeking over the data of chunks not required
+// NOTE: If chunks is NULL, chunks are only counted (no data is read); if chunk_type is provided,
+// only chunks of that type are read. Up to max_count chunks are read, IEND included, returns chunks count
+static int read_file_chunks(const char *filename, const char *chunk_type, rpng_chunk *chunks, int max_count)
+{
+    int count = 0;
+
+#if !defined(RPNG_NO_STDIO)
+    FILE *file = NULL;
+    if ((filename != NULL) && file_exists(filename)) file = fopen(filename, "rb");
+
+    if (file != NULL)
+    {
+        unsigned char signature[8] = { 0 };
+
+        // Get file size, required to validate skipped chunks (seeking past EOF does not fail)
+        fseek(file, 0, SEEK_END);
+        long file_size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        // Check valid PNG file
+        if ((fread(signature, 1, 8, file) == 8) && (memcmp(signature, png_signature, 8) == 0))
+        {
+            unsigned char header[8] = { 0 };    // Chunk Length + FOURCC
+            long position = 8;                  // File position after chunk header
+
+            while (fread(header, 1, 8, file) == 8)
+            {
+                unsigned int chunk_size = ((unsigned int)header[0] << 24) | ((unsigned int)header[1] << 16) | ((unsigned int)header[2] << 8) | (unsigned int)header[3];
+                bool is_iend = (memcmp(header + 4, "IEND", 4) == 0);
+
+                position += 8;
+
+                if (chunk_size > 0x7fffffff) break;     // WARNING: Chunk length not valid (PNG limit: 2^31 - 1)
+                if ((unsigned long)(file_size - position) < (unsigned long)chunk_size + 4) break;   // WARNING: File truncated, chunk data + CRC32 not available
+
+                position += (long)chunk_size + 4;
+
+                if ((chunks != NULL) && ((chunk_type == NULL) || (memcmp(header + 4, chunk_type, 4) == 0)))
+                {
+                    if (count >= max_count)
+                    {
+                        RPNG_LOG("WARNING: Too many chunks, only first %i chunks read\n", max_count);
+                        break;
+                    }
+
+                    unsigned char crc[4] = { 0 };
+                    rpng_chunk chunk = { 0 };
+
+                    chunk.length = chunk_size;
+                    memcpy(chunk.type, header + 4, 4);
+                    chunk.data = (unsigned char *)RPNG_MALLOC(chunk_size);
+
+                    if ((fread(chunk.data, 1, chunk_size, file) != chunk_size) || (fread(crc, 1, 4, file) != 4))
+                    {
+                        RPNG_FREE(chunk.data);
+                        break;                          // WARNING: File truncated
+                    }
+
+                    chunk.crc = ((unsigned int)crc[0] << 24) | ((unsigned int)crc[1] << 16) | ((unsigned int)crc[2] << 8) | (unsigned int)crc[3];
+                    chunks[count] = chunk;
+                    count++;
+
+                    if ((chunk_type != NULL) && (count >= max_count)) break;
+                }
+                else
+                {
+                    // Skip chunk data + CRC32, no data is read
+                    if (fseek(file, (long)chunk_size + 4, SEEK_CUR) != 0) break;
+                    if (chunks == NULL) count++;
+                }
+
+                if (is_iend) break;
+            }
+        }
+        else RPNG_LOG("FILEIO: [%s] File is not a valid PNG\n", filename);
+
+        fclose(file);
+    }
+    else RPNG_LOG("FILEIO: [%s] Failed to open file\n", filename);
+#else
+    (void)filename;
+    (void)chunk_type;
+    (void)chunks;
+    (void)max_count;
+    #warning No FILE I/O API, RPNG_NO_STDIO defined
+#endif
+    return count;
+}
+
 // Check if the file exists
 static bool file_exists(const char *filename)
 {
@@ -1957,6 +3226,140 @@ static bool file_exists(const char *filename)
     return result;
 }
 
+// Generate tEXt chunk
+static rpng_chunk gen_chunk_text(char *keyword, char *text)
+{
+    rpng_chunk chunk = { 0 };
+
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
+
+    memcpy(chunk.type, "tEXt", 4);
+    chunk.length = keyword_len + 1 + text_len;
+    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 1, text, text_len);
+
+    return chunk;
+}
+
+// Generate zTXt chunk, DEFLATE compressed text
+static rpng_chunk gen_chunk_comp_text(char *keyword, char *text)
+{
+    rpng_chunk chunk = { 0 };
+
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
+
+    // Compress text data and generate a valid zlib stream
+    struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
+    int bounds = sdefl_bound(text_len);
+    unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
+    int comp_text_size = zsdeflate(sde, comp_text, (unsigned char *)text, text_len, 8);   // Compression level 8, same as stbiw
+    RPNG_FREE(sde);
+
+    // NOTE: Keyword is followed by NULL separator and compression method (0: DEFLATE)
+    memcpy(chunk.type, "zTXt", 4);
+    chunk.length = keyword_len + 1 + 1 + comp_text_size;
+    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
+
+    RPNG_FREE(comp_text);
+
+    return chunk;
+}
+
+// Generate gAMA chunk
+// NOTE: Gamma is stored as one int: gamma*100000
+static rpng_chunk gen_chunk_gamma(float gamma)
+{
+    rpng_chunk chunk = { 0 };
+
+    unsigned int gamma_value = swap_endian((unsigned int)(gamma*100000));
+
+    memcpy(chunk.type, "gAMA", 4);
+    chunk.length = 4;
+    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, &gamma_value, 4);
+
+    return chunk;
+}
+
+// Generate sRGB chunk
+static rpng_chunk gen_chunk_srgb(char srgb_type)
+{
+    rpng_chunk chunk = { 0 };
+
+    if ((srgb_type < 0) || (srgb_type > 3)) srgb_type = 0;
+
+    memcpy(chunk.type, "sRGB", 4);
+    chunk.length = 1;
+    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
+    chunk.data[0] = (unsigned char)srgb_type;
+
+    return chunk;
+}
+
+// Generate tIME chunk
+// NOTE: Year is stored as 2 bytes big endian, as all PNG multi-byte values
+static rpng_chunk gen_chunk_time(short year, char month, char day, char hour, char min, char sec)
+{
+    rpng_chunk chunk = { 0 };
+
+    memcpy(chunk.type, "tIME", 4);
+    chunk.length = 7;
+    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
+    chunk.data[0] = (unsigned char)((year >> 8) & 0xff);
+    chunk.data[1] = (unsigned char)(year & 0xff);
+    chunk.data[2] = (unsigned char)month;
+    chunk.data[3] = (unsigned char)day;
+    chunk.data[4] = (unsigned char)hour;
+    chunk.data[5] = (unsigned char)min;
+    chunk.data[6] = (unsigned char)sec;
+
+    return chunk;
+}
+
+// Generate pHYs chunk
+static rpng_chunk gen_chunk_physical_size(int pixels_unit_x, int pixels_unit_y, bool meters)
+{
+    rpng_chunk chunk = { 0 };
+
+    unsigned int pixels_unit_x_be = swap_endian(pixels_unit_x);
+    unsigned int pixels_unit_y_be = swap_endian(pixels_unit_y);
+
+    memcpy(chunk.type, "pHYs", 4);
+    chunk.length = 9;
+    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, &pixels_unit_x_be, 4);
+    memcpy(chunk.data + 4, &pixels_unit_y_be, 4);
+    chunk.data[8] = (meters)? 1 : 0;
+
+    return chunk;
+}
+
+// Generate cHRM chunk
+// NOTE: Each value is stored as one int: value*100000
+static rpng_chunk gen_chunk_chroma(float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
+{
+    rpng_chunk chunk = { 0 };
+
+    float values[8] = { white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y };
+
+    memcpy(chunk.type, "cHRM", 4);
+    chunk.length = 8*4;     // 8 integer values
+    chunk.data = (unsigned char *)RPNG_CALLOC(chunk.length, 1);
+
+    for (int i = 0; i < 8; i++)
+    {
+        unsigned int value = swap_endian((unsigned int)(values[i]*100000));
+        memcpy(chunk.data + i*4, &value, 4);
+    }
+
+    return chunk;
+}
+
 #if defined(RPNG_DEFLATE_IMPLEMENTATION)
 
 //=========================================================================
@@ -2450,7 +3853,7 @@ sdefl_fnd(struct sdefl_match *m, const struct sdefl *s, int chain_len,
 }
 static int
 sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
-            int in_len, int lvl) {
+            int in_len, int lvl, int last) {
   unsigned char *q = out;
   static const unsigned char pref[] = {8,10,14,24,30,48,65,96,130};
   int max_chain = (lvl < 8) ? (1 << (lvl + 1)): (1 << 13);
@@ -2507,8 +3910,12 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
       sdefl_seq(s, i - litlen, litlen);
       litlen = 0;
     }
-    sdefl_flush(&q, s, blk_end == in_len, in, blk_begin, blk_end);
+    sdefl_flush(&q, s, last && blk_end == in_len, in, blk_begin, blk_end);
   } while (i < in_len);
+  if (!last) {
+    /* non-final output is not padded, pending bits kept */
+    return (int)(q - out);
+  }
   if (s->bitcnt) {
     sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
   }
@@ -2518,7 +3925,27 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
 extern int
 sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
-  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl);
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl, 1);
+}
+extern int
+sdeflate_block(struct sdefl *s, void *out, const void *in, int n, int lvl, int last) {
+  unsigned char *q = (unsigned char*)out;
+  const unsigned char *src = (const unsigned char*)in;
+  s->bits = s->bitcnt = 0;
+  if (last || n < 2) {
+    return sdefl_compr(s, q, src, n, lvl, 1);
+  }
+  /* non-final: last input byte is written in a stored block, it byte aligns
+   * output for concatenation (empty stored blocks are rejected by sinfl) */
+  q += sdefl_compr(s, q, src, n - 1, lvl, 0);
+  sdefl_put(&q, s, 0x00, 3); /* stored block, not final */
+  if (s->bitcnt) {
+    sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+  }
+  sdefl_put16(&q, 0x0001);
+  sdefl_put16(&q, 0xFFFE);
+  *q++ = src[n - 1];
+  return (int)(q - (unsigned char*)out);
 }
 static unsigned
 sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
@@ -2560,7 +3987,7 @@ zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
   sdefl_put(&q, s, 0x78, 8); /* deflate, 32k window */
   sdefl_put(&q, s, 0x01, 8); /* fast compression */
-  q += sdefl_compr(s, q, (const unsigned char*)in, n, lvl);
+  q += sdefl_compr(s, q, (const unsigned char*)in, n, lvl, 1);
 
   /* append adler checksum */
   a = sdefl_adler32(SDEFL_ADLER_INIT, (const unsigned char*)in, n);
@@ -2656,11 +4083,31 @@ sinfl_copy128(unsigned char **dst, unsigned char **src) {
 #endif
 static void
 sinfl_refill(struct sinfl *s) {
-  s->bitbuf |= sinfl_read64(s->bitptr) << s->bitcnt;
-  s->bitptr += (63 - s->bitcnt) >> 3;
+  if (sinfl_likely(s->bitend - s->bitptr >= 8)) {
+    s->bitbuf |= sinfl_read64(s->bitptr) << s->bitcnt;
+    s->bitptr += (63 - s->bitcnt) >> 3;
+  } else {
+    /* input end: remaining bytes are read, zeros are fed past the end
+     * and counted in bitover to detect streams consuming them */
+    unsigned char tail[8] = {0};
+    int avail = (int)(s->bitend - s->bitptr);
+    int adv = (63 - s->bitcnt) >> 3;
+    memcpy(tail, s->bitptr, (size_t)avail);
+    s->bitbuf |= sinfl_read64(tail) << s->bitcnt;
+    if (adv > avail) {
+      s->bitover += adv - avail;
+      adv = avail;
+    }
+    s->bitptr += adv;
+  }
   s->bitcnt |= 56; /* bitcount in range [56,63] */
 }
 static int
+sinfl_overread(const struct sinfl *s) {
+  /* bits consumed past the input end (zeros fed by refill) */
+  return s->bitover * 8 > s->bitcnt;
+}
+static int
 sinfl_peek(struct sinfl *s, int cnt) {
   assert(cnt >= 0 && cnt <= 56);
   assert(cnt <= s->bitcnt);
@@ -2811,7 +4258,11 @@ sinfl_decode(struct sinfl *s, const unsigned *tbl, int bit_len) {
   return (key >> 16) & 0x0fff;
 }
 static int
-sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size) {
+sinfl_run(struct sinfl *s, const unsigned char *o, unsigned char **pout,
+          const unsigned char *oe, const unsigned char *stop) {
+  /* rpng: resumable decoding, returns 1 if output reached stop position
+   * or ran out of space (decoding continues on next call), 0 when done
+   * (or on invalid data) and -1 if input end was overread */
   static const unsigned char order[] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
   static const short dbase[30+2] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
       257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
@@ -2821,25 +4272,28 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       43,51,59,67,83,99,115,131,163,195,227,258,0,0};
   static const unsigned char lbits[29+2] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,
       4,4,4,5,5,5,5,0,0,0};
+  static const unsigned char period8[8] = {0,8,8,9,8,10,12,14}; /* smallest offs multiple >= 8 */
 
-  const unsigned char *oe = out + cap;
-  const unsigned char *e = in + size, *o = out;
-  enum sinfl_states {hdr,stored,fixed,dyn,blk};
-  enum sinfl_states state = hdr;
-  struct sinfl s = {0};
-  int last = 0;
+  enum sinfl_states {hdr,stored,copy,fixed,dyn,blk};
+  unsigned char *out = *pout;
+  const unsigned char *e = s->bitend;
+  enum sinfl_states state = (enum sinfl_states)s->state;
+  int last = s->last;
+  int res = 0;
 
-  s.bitptr = in;
   while (1) {
     switch (state) {
     case hdr: {
       /* block header */
       int type = 0;
-      sinfl_refill(&s);
-      last = sinfl__get(&s,1);
-      type = sinfl__get(&s,2);
+      if (sinfl_overread(s)) {
+        res = -1; goto end;
+      }
+      sinfl_refill(s);
+      last = sinfl__get(s,1);
+      type = sinfl__get(s,2);
 
-      switch (type) {default: return (int)(out-o);
+      switch (type) {default: goto end;
       case 0x00: state = stored; break;
       case 0x01: state = fixed; break;
       case 0x02: state = dyn; break;}
@@ -2847,20 +4301,35 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
     case stored: {
       /* uncompressed block */
       unsigned len, nlen;
-      sinfl__get(&s,s.bitcnt & 7);
-      len = (unsigned short)sinfl__get(&s,16);
-      nlen = (unsigned short)sinfl__get(&s,16);
-      s.bitptr -= s.bitcnt / 8;
-      s.bitbuf = s.bitcnt = 0;
+      sinfl__get(s,s->bitcnt & 7);
+      len = (unsigned short)sinfl__get(s,16);
+      nlen = (unsigned short)sinfl__get(s,16);
+      if (s->bitover > s->bitcnt / 8) {
+        res = -1; goto end;
+      }
+      s->bitptr -= s->bitcnt / 8 - s->bitover;
+      s->bitbuf = 0;
+      s->bitcnt = s->bitover = 0;
 
       if ((unsigned short)len != (unsigned short)~nlen)
-        return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
-        return (int)(out-o);
-
-      memcpy(out, s.bitptr, (size_t)len);
-      s.bitptr += len, out += len;
-      if (last) return (int)(out-o);
+        goto end;
+      if (len > (e - s->bitptr))
+        goto end;
+      s->stored = len;
+      state = copy;
+    } break;
+    case copy: {
+      /* stored block data, copied up to available output space */
+      unsigned len = s->stored;
+      if (len > (unsigned)(oe - out))
+        len = (unsigned)(oe - out);
+      memcpy(out, s->bitptr, (size_t)len);
+      s->bitptr += len, out += len;
+      s->stored -= len;
+      if (s->stored) {
+        res = 1; goto end;
+      }
+      if (last) goto end;
       state = hdr;
     } break;
     case fixed: {
@@ -2873,8 +4342,8 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       for (n = 0; n < 32; n++) lens[288+n] = 5;
 
       /* build lit/dist tables */
-      sinfl_build(s.lits, lens, 10, 15, 288);
-      sinfl_build(s.dsts, lens + 288, 8, 15, 32);
+      sinfl_build(s->lits, lens, 10, 15, 288);
+      sinfl_build(s->dsts, lens + 288, 8, 15, 32);
       state = blk;
     } break;
     case dyn: {
@@ -2883,65 +4352,83 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       unsigned hlens[SINFL_PRE_TBL_SIZE];
       unsigned char nlens[19] = {0}, lens[288+32];
 
-      sinfl_refill(&s);
-      {int nlit = 257 + sinfl__get(&s,5);
-      int ndist = 1 + sinfl__get(&s,5);
-      int nlen = 4 + sinfl__get(&s,4);
+      sinfl_refill(s);
+      {int nlit = 257 + sinfl__get(s,5);
+      int ndist = 1 + sinfl__get(s,5);
+      int nlen = 4 + sinfl__get(s,4);
       for (n = 0; n < nlen; n++)
-        nlens[order[n]] = (unsigned char)sinfl_get(&s,3);
+        nlens[order[n]] = (unsigned char)sinfl_get(s,3);
       sinfl_build(hlens, nlens, 7, 7, 19);
 
       /* decode code lengths */
       for (n = 0; n < nlit + ndist;) {
-        int sym = 0;
-        sinfl_refill(&s);
-        sym = sinfl_decode(&s, hlens, 7);
-        switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        int sym = 0, rep = 0;
+        sinfl_refill(s);
+        sym = sinfl_decode(s, hlens, 7);
+        switch (sym) {default: lens[n++] = (unsigned char)sym; continue;
+        case 16: rep = 3 + sinfl__get(s,2); break;
+        case 17: rep = 3 + sinfl__get(s,3); break;
+        case 18: rep = 11 + sinfl__get(s,7); break;}
+        /* repeated code lengths must stay inside table */
+        if ((sym == 16 && n == 0) || n + rep > nlit + ndist) {
+          goto end;
+        }
+        for (i = 0; i < rep; i++, n++) {
+          lens[n] = (sym == 16) ? lens[n-1] : 0;
+        }
       }
       /* build lit/dist tables */
-      sinfl_build(s.lits, lens, 10, 15, nlit);
-      sinfl_build(s.dsts, lens + nlit, 8, 15, ndist);
+      sinfl_build(s->lits, lens, 10, 15, nlit);
+      sinfl_build(s->dsts, lens + nlit, 8, 15, ndist);
       state = blk;}
     } break;
     case blk: {
       /* decompress block */
       while (1) {
         int sym;
-        sinfl_refill(&s);
-        sym = sinfl_decode(&s, s.lits, 10);
+        if (sinfl_unlikely(out > stop)) {
+          /* not enough space for next codes output */
+          res = 1; goto end;
+        }
+        sinfl_refill(s);
+        sym = sinfl_decode(s, s->lits, 10);
         if (sym < 256) {
           /* literal */
           if (sinfl_unlikely(out >= oe)) {
-            return (int)(out-o);
+            goto end;
           }
           *out++ = (unsigned char)sym;
-          sym = sinfl_decode(&s, s.lits, 10);
+          sym = sinfl_decode(s, s->lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              goto end;
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
+          /* match bits (up to 33) might not be available after two codes */
+          sinfl_refill(s);
         }
         if (sinfl_unlikely(sym == 256)) {
           /* end of block */
-          if (last) return (int)(out-o);
+          if (last) {
+            res = sinfl_overread(s) ? -1 : 0; goto end;
+          }
           state = hdr;
           break;
         }
         /* match */
         if (sym >= 286) {
           /* length codes 286 and 287 must not appear in compressed data */
-          return (int)(out-o);
+          goto end;
         }
         sym -= 257;
-        {int len = sinfl__get(&s, lbits[sym]) + lbase[sym];
-        int dsym = sinfl_decode(&s, s.dsts, 8);
-        int offs = sinfl__get(&s, dbits[dsym]) + dbase[dsym];
+        {int len = sinfl__get(s, lbits[sym]) + lbase[sym];
+        int dsym = sinfl_decode(s, s->dsts, 8);
+        int offs = sinfl__get(s, dbits[dsym]) + dbase[dsym];
         unsigned char *dst = out, *src = out - offs;
-        if (sinfl_unlikely(offs > (int)(out-o))) {
-          return (int)(out-o);
+        if (sinfl_unlikely(offs > (int)(out-o) || len > (int)(oe-out))) {
+          goto end;
         }
         out = out + len;
 
@@ -2959,6 +4446,17 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
             sinfl_copy64(&dst, &src);
             do sinfl_copy64(&dst, &src);
             while (dst < out);
+          } else if (offs > 1) {
+            /* short period match: bytes repeat every offs bytes, once enough
+             * bytes are copied source is moved back to a period multiple >= 8 */
+            int n = period8[offs] - offs;
+            do *dst++ = *src++;
+            while (--n);
+            src = dst - period8[offs];
+            sinfl_copy64(&dst, &src);
+            sinfl_copy64(&dst, &src);
+            do sinfl_copy64(&dst, &src);
+            while (dst < out);
           } else if (offs == 1) {
             /* rle match copying */
             sinfl_char16 w = sinfl_char16_char(src[0]);
@@ -2982,6 +4480,17 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
             sinfl_copy64(&dst, &src);
             do sinfl_copy64(&dst, &src);
             while (dst < out);
+          } else if (offs > 1) {
+            /* short period match: bytes repeat every offs bytes, once enough
+             * bytes are copied source is moved back to a period multiple >= 8 */
+            int n = period8[offs] - offs;
+            do *dst++ = *src++;
+            while (--n);
+            src = dst - period8[offs];
+            sinfl_copy64(&dst, &src);
+            sinfl_copy64(&dst, &src);
+            do sinfl_copy64(&dst, &src);
+            while (dst < out);
           } else if (offs == 1) {
             /* rle match copying */
             unsigned int c = src[0];
@@ -3009,7 +4518,22 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       }
     } break;}
   }
-  return (int)(out-o);
+end:
+  *pout = out;
+  s->state = (int)state;
+  s->last = last;
+  return res;
+}
+static int
+sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size) {
+  struct sinfl s = {0};
+  unsigned char *end = out;
+  s.bitptr = in;
+  s.bitend = in + size;
+  if (sinfl_run(&s, out, &end, out + cap, out + cap) < 0) {
+    return -1;
+  }
+  return (int)(end-out);
 }
 extern int
 sinflate(void *out, int cap, const void *in, int size) {
@@ -3047,8 +4571,12 @@ zsinflate(void *out, int cap, const void *mem, int size) {
   const unsigned char *in = (const unsigned char*)mem;
   if (size >= 6) {
     const unsigned char *eob = in + size - 4;
-    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size);
-    unsigned a = sinfl_adler32(1u, (unsigned char*)out, n);
+    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size - 6);
+    unsigned a = 0;
+    if (n < 0) {
+      return -1;
+    }
+    a = sinfl_adler32(1u, (unsigned char*)out, n);
     unsigned h = eob[0] << 24 | eob[1] << 16 | eob[2] << 8 | eob[3] << 0;
     return a == h ? n : -1;
   } else {
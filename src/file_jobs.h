@@ -0,0 +1,344 @@
+/**********************************************************************************************
+*
+*   rGuiLayout - File Jobs
+*
+*   Asynchronous file operations (loading, saving, decoding) processed by worker threads,
+*   so slow disks or network mounts do not block the render loop
+*
+*   Every job provides two callbacks:
+*       - process(): Called on a worker thread, it must only access job data (no GPU or editor state)
+*       - complete(): Called on main thread by ProcessFileJobs(), job results are applied there
+*
+*   NOTE: Jobs on the same file are processed in submission order (never concurrently),
+*   jobs on different files can be processed concurrently by different workers
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2018-2022 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef FILE_JOBS_H
+#define FILE_JOBS_H
+
+// File jobs on worker threads support
+// NOTE: Not available on PLATFORM_WEB and MSVC (no pthreads), jobs are processed on submission
+#if !defined(PLATFORM_WEB) && !defined(_MSC_VER)
+    #define FILE_JOBS_SUPPORT_THREADS
+#endif
+
+#define FILE_JOBS_MAX_WORKERS           2       // Maximum worker threads
+#define FILE_JOBS_MAX_FILENAME_LENGTH 512       // Maximum job file name length
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct FileJob FileJob;
+
+// File job callback
+typedef void (*FileJobCallback)(FileJob *job);
+
+// File job type
+struct FileJob {
+    char fileName[FILE_JOBS_MAX_FILENAME_LENGTH];   // File to be processed
+    void *data;                     // Job data: provided on submission and/or returned by process()
+    void *userData;                 // User data, available to callbacks
+    bool result;                    // Job process result, set by process()
+    FileJobCallback process;        // Process callback, called on worker thread
+    FileJobCallback complete;       // Completion callback, called on main thread (can be NULL)
+    FileJob *next;                  // Next job in queue
+};
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void SubmitFileJob(const char *fileName, FileJobCallback process, FileJobCallback complete, void *data, void *userData);  // Submit file job
+int ProcessFileJobs(void);          // Call completion callbacks of finished jobs, returns unfinished jobs count
+void WaitFileJobs(void);            // Wait for all submitted jobs to finish and call their completion callbacks
+void CloseFileJobs(void);           // Wait for all submitted jobs and close worker threads
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FILE_JOBS_H
+
+/***********************************************************************************
+*
+*   FILE_JOBS_IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(FILE_JOBS_IMPLEMENTATION)
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+    #include <pthread.h>            // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()...
+#endif
+
+#include <string.h>                 // Required for: strncpy(), strcmp()
+
+//----------------------------------------------------------------------------------
+// Global variables definition
+//----------------------------------------------------------------------------------
+static FileJob *pendingJobsFirst = NULL;    // Jobs waiting to be processed (FIFO)
+static FileJob *pendingJobsLast = NULL;
+static FileJob *finishedJobsFirst = NULL;   // Jobs processed, waiting for completion callback (FIFO)
+static FileJob *finishedJobsLast = NULL;
+static int unfinishedJobsCount = 0;         // Jobs submitted and not yet completed
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+static pthread_t fileWorkers[FILE_JOBS_MAX_WORKERS];
+static FileJob *fileWorkersJob[FILE_JOBS_MAX_WORKERS] = { 0 };  // Job being processed by every worker
+static int fileWorkersCount = 0;
+static pthread_mutex_t fileJobsMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fileJobSubmittedCond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t fileJobFinishedCond = PTHREAD_COND_INITIALIZER;
+static bool fileWorkersClose = false;
+#endif
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void PushFinishedFileJob(FileJob *job);      // Add processed job to finished jobs queue
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+static FileJob *PopPendingFileJob(void);            // Get next pending job not conflicting with running jobs
+static void *FileJobsWorker(void *arg);             // Worker thread, processes pending jobs
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Submit file job
+// NOTE: Worker threads are created on first submission, up to FILE_JOBS_MAX_WORKERS
+void SubmitFileJob(const char *fileName, FileJobCallback process, FileJobCallback complete, void *data, void *userData)
+{
+    FileJob *job = (FileJob *)RL_CALLOC(1, sizeof(FileJob));
+
+    if (fileName != NULL) strncpy(job->fileName, fileName, FILE_JOBS_MAX_FILENAME_LENGTH - 1);
+    job->process = process;
+    job->complete = complete;
+    job->data = data;
+    job->userData = userData;
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+    pthread_mutex_lock(&fileJobsMutex);
+
+    unfinishedJobsCount++;
+
+    if (pendingJobsLast != NULL) pendingJobsLast->next = job;
+    else pendingJobsFirst = job;
+    pendingJobsLast = job;
+
+    // Create a new worker if all current ones could be busy
+    if ((fileWorkersCount < FILE_JOBS_MAX_WORKERS) && (fileWorkersCount < unfinishedJobsCount))
+    {
+        fileWorkersClose = false;
+        if (pthread_create(&fileWorkers[fileWorkersCount], NULL, FileJobsWorker, (void *)(size_t)fileWorkersCount) == 0) fileWorkersCount++;
+    }
+
+    if (fileWorkersCount > 0)
+    {
+        pthread_cond_broadcast(&fileJobSubmittedCond);
+        pthread_mutex_unlock(&fileJobsMutex);
+        return;
+    }
+
+    // Worker thread could not be created, process job synchronously
+    pendingJobsFirst = NULL;
+    pendingJobsLast = NULL;
+    pthread_mutex_unlock(&fileJobsMutex);
+    TraceLog(LOG_WARNING, "FILEJOBS: Worker thread could not be created, processing job synchronously");
+#else
+    unfinishedJobsCount++;
+#endif
+
+    if (job->process != NULL) job->process(job);
+    PushFinishedFileJob(job);
+}
+
+// Call completion callbacks of finished jobs
+// NOTE: Must be called from main thread, usually once per frame
+int ProcessFileJobs(void)
+{
+    int count = 0;
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+    pthread_mutex_lock(&fileJobsMutex);
+#endif
+
+    FileJob *job = finishedJobsFirst;
+    finishedJobsFirst = NULL;
+    finishedJobsLast = NULL;
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+    pthread_mutex_unlock(&fileJobsMutex);
+#endif
+
+    // NOTE: Callbacks are called without the lock, they can submit new jobs
+    while (job != NULL)
+    {
+        FileJob *next = job->next;
+
+        if (job->complete != NULL) job->complete(job);
+        RL_FREE(job);
+        count++;
+
+        job = next;
+    }
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+    pthread_mutex_lock(&fileJobsMutex);
+#endif
+
+    unfinishedJobsCount -= count;
+    count = unfinishedJobsCount;
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+    pthread_mutex_unlock(&fileJobsMutex);
+#endif
+
+    return count;
+}
+
+// Wait for all submitted jobs to finish and call their completion callbacks
+void WaitFileJobs(void)
+{
+    while (true)
+    {
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+        pthread_mutex_lock(&fileJobsMutex);
+        while ((finishedJobsFirst == NULL) && (unfinishedJobsCount > 0)) pthread_cond_wait(&fileJobFinishedCond, &fileJobsMutex);
+        pthread_mutex_unlock(&fileJobsMutex);
+#endif
+        if (ProcessFileJobs() == 0) break;
+    }
+}
+
+// Wait for all submitted jobs and close worker threads
+// NOTE: Pending jobs are not discarded, it avoids losing saved data on closing
+void CloseFileJobs(void)
+{
+    WaitFileJobs();
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+    pthread_mutex_lock(&fileJobsMutex);
+    int workersCount = fileWorkersCount;
+    fileWorkersClose = true;
+    pthread_cond_broadcast(&fileJobSubmittedCond);
+    pthread_mutex_unlock(&fileJobsMutex);
+
+    for (int i = 0; i < workersCount; i++) pthread_join(fileWorkers[i], NULL);
+    fileWorkersCount = 0;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Add processed job to finished jobs queue
+// NOTE: Called with jobs mutex locked (if threads supported)
+static void PushFinishedFileJob(FileJob *job)
+{
+    job->next = NULL;
+
+    if (finishedJobsLast != NULL) finishedJobsLast->next = job;
+    else finishedJobsFirst = job;
+    finishedJobsLast = job;
+}
+
+#if defined(FILE_JOBS_SUPPORT_THREADS)
+// Get next pending job not conflicting with running jobs
+// NOTE: A job on a file already being processed waits, keeping per-file submission order
+static FileJob *PopPendingFileJob(void)
+{
+    FileJob *prev = NULL;
+
+    for (FileJob *job = pendingJobsFirst; job != NULL; prev = job, job = job->next)
+    {
+        bool conflict = false;
+
+        for (int i = 0; (i < fileWorkersCount) && !conflict; i++)
+        {
+            if ((fileWorkersJob[i] != NULL) && (strcmp(fileWorkersJob[i]->fileName, job->fileName) == 0)) conflict = true;
+        }
+
+        // Previous pending jobs on same file must be processed first
+        for (FileJob *other = pendingJobsFirst; (other != job) && !conflict; other = other->next)
+        {
+            if (strcmp(other->fileName, job->fileName) == 0) conflict = true;
+        }
+
+        if (!conflict)
+        {
+            if (prev != NULL) prev->next = job->next;
+            else pendingJobsFirst = job->next;
+            if (pendingJobsLast == job) pendingJobsLast = prev;
+
+            job->next = NULL;
+            return job;
+        }
+    }
+
+    return NULL;
+}
+
+// Worker thread, processes pending jobs until close is requested
+static void *FileJobsWorker(void *arg)
+{
+    int workerIndex = (int)(size_t)arg;
+
+    pthread_mutex_lock(&fileJobsMutex);
+
+    while (!fileWorkersClose)
+    {
+        FileJob *job = PopPendingFileJob();
+
+        if (job == NULL)
+        {
+            pthread_cond_wait(&fileJobSubmittedCond, &fileJobsMutex);
+            continue;
+        }
+
+        fileWorkersJob[workerIndex] = job;
+        pthread_mutex_unlock(&fileJobsMutex);
+
+        if (job->process != NULL) job->process(job);
+
+        pthread_mutex_lock(&fileJobsMutex);
+        fileWorkersJob[workerIndex] = NULL;
+        PushFinishedFileJob(job);
+
+        // NOTE: Jobs blocked by this one on the same file can be processed now
+        pthread_cond_broadcast(&fileJobSubmittedCond);
+        pthread_cond_broadcast(&fileJobFinishedCond);
+    }
+
+    pthread_mutex_unlock(&fileJobsMutex);
+
+    return NULL;
+}
+#endif
+
+#endif // FILE_JOBS_IMPLEMENTATION
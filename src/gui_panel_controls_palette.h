@@ -8,6 +8,11 @@
 *
 *       INIT: GuiPanelControlsPaletteState state = InitGuiPanelControlsPalette();
 *       DRAW: GuiPanelControlsPalette(&state);
+*       DEINIT: UnloadGuiPanelControlsPalette(&state);
+*
+*   NOTE: Palette controls samples are rendered once into a render texture (they are always
+*   locked, so their look does not depend on mouse hover), texture is redrawn on style change
+*   and selected control highlight is drawn over it every frame
 *
 *   LICENSE: zlib/libpng
 *
@@ -41,6 +46,9 @@
 
 #define CONTROLS_PALETTE_COUNT  24
 
+#define CONTROLS_PALETTE_CONTENT_WIDTH      160     // Controls samples content width (preview texture width)
+#define CONTROLS_PALETTE_CONTENT_HEIGHT     960     // Controls samples content height (preview texture height)
+
 typedef struct GuiPanelControlsPaletteState {
 
     bool panelActive;
@@ -80,6 +88,10 @@ typedef struct GuiPanelControlsPaletteState {
     bool dropdownBoxEditMode;               // GuiDropdownBox()
     int dropdownBoxActive;
 
+    // Controls samples preview, redrawn on style change
+    RenderTexture2D previewTarget;          // Controls samples render texture (content space)
+    unsigned int previewStyleHash;          // Style hash of current preview (0 if preview not drawn)
+
 } GuiPanelControlsPaletteState;
 
 #ifdef __cplusplus
@@ -112,6 +124,7 @@ extern "C" {            // Prevents name mangling of functions
 GuiPanelControlsPaletteState InitGuiPanelControlsPalette(void);
 void GuiPanelControlsPalette(GuiPanelControlsPaletteState *state);
 void UpdateControlsPaletteRecs(GuiPanelControlsPaletteState *state);
+void UnloadGuiPanelControlsPalette(GuiPanelControlsPaletteState *state);    // Unload controls samples preview texture
 
 #ifdef __cplusplus
 }
@@ -128,6 +141,12 @@ void UpdateControlsPaletteRecs(GuiPanelControlsPaletteState *state);
 
 #include "raygui.h"
 
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int GetControlsPaletteStyleHash(void);                      // Get current style hash (properties, font and state)
+static void DrawControlsPaletteSamples(GuiPanelControlsPaletteState *state); // Draw palette controls samples at current controls rectangles
+
 GuiPanelControlsPaletteState InitGuiPanelControlsPalette(void)
 {
     GuiPanelControlsPaletteState state = { 0 };
@@ -240,47 +259,127 @@ void GuiPanelControlsPalette(GuiPanelControlsPaletteState *state)
             (Rectangle){ state->panelBounds.x, state->panelBounds.y, state->panelBounds.width - 16, 944 }, // WARNING: Hardcoded content height!
             &state->containerScrollOffset, &scissorRec);
 
+        // Redraw controls samples preview on style change
+        // NOTE: Samples are drawn in content space, panel position and scroll only offset the preview
+        unsigned int styleHash = GetControlsPaletteStyleHash();
+
+        if (state->previewTarget.id == 0) state->previewTarget = LoadRenderTexture(CONTROLS_PALETTE_CONTENT_WIDTH, CONTROLS_PALETTE_CONTENT_HEIGHT);
+
+        if ((state->previewTarget.id > 0) && (state->previewStyleHash != styleHash))
+        {
+            Rectangle panelBounds = state->panelBounds;
+            Vector2 containerScrollOffset = state->containerScrollOffset;
+
+            state->panelBounds.x = 0;
+            state->panelBounds.y = 0;
+            state->containerScrollOffset = (Vector2){ 0, 0 };
+            UpdateControlsPaletteRecs(state);
+
+            // NOTE: Preview is cleared to scroll panel background color, so it is fully opaque
+            // and semi-transparent controls parts are not blended twice when drawing it
+            BeginTextureMode(state->previewTarget);
+                ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+                DrawControlsPaletteSamples(state);
+            EndTextureMode();
+
+            state->panelBounds = panelBounds;
+            state->containerScrollOffset = containerScrollOffset;
+            UpdateControlsPaletteRecs(state);
+
+            state->previewStyleHash = styleHash;
+        }
+
         // Limit drawing to scroll panel bounds
         // WARNING: It requires a batch processing and restart
         BeginScissorMode(scissorRec.x, scissorRec.y, scissorRec.width, scissorRec.height);
 
-            GuiLock();
-
-            state->windowBoxActive = !GuiWindowBox(state->controlRecs[GUI_WINDOWBOX], "WindowBox");
-            GuiGroupBox(state->controlRecs[GUI_GROUPBOX], "GroupBox");
-            GuiLine(state->controlRecs[GUI_LINE], NULL);
-            GuiPanel(state->controlRecs[GUI_PANEL], NULL);
-            GuiLabel(state->controlRecs[GUI_LABEL], "Label");
-            state->buttonPressed = GuiButton(state->controlRecs[GUI_BUTTON], "Button");
-            state->labelBtnPressed = GuiLabelButton(state->controlRecs[GUI_LABELBUTTON], "LabelButton");
-            GuiCheckBox(state->controlRecs[GUI_CHECKBOX], "", &state->checkBoxChecked);
-            GuiToggle(state->controlRecs[GUI_TOGGLE], "Toggle", &state->toggleActive);
-            GuiToggleGroup((Rectangle) { state->controlRecs[GUI_TOGGLEGROUP].x, state->controlRecs[GUI_TOGGLEGROUP].y, (state->controlRecs[GUI_TOGGLEGROUP].width - GuiGetStyle(TOGGLE, GROUP_PADDING)*2.0f)/3.0f, state->controlRecs[GUI_TOGGLEGROUP].height }, "ONE;TWO;THREE", &state->toggleGroupActive);
-            GuiComboBox(state->controlRecs[GUI_COMBOBOX], "ONE;TWO;THREE", &state->comboBoxActive);
-            if (GuiTextBox(state->controlRecs[GUI_TEXTBOX], state->textBoxText, 64, state->textBoxEditMode)) state->textBoxEditMode = !state->textBoxEditMode;
-            if (GuiValueBox(state->controlRecs[GUI_VALUEBOX], NULL, &state->valueBoxValue, 0, 100, state->valueBoxEditMode)) state->valueBoxEditMode = !state->valueBoxEditMode;
-            if (GuiSpinner(state->controlRecs[GUI_SPINNER], NULL, &state->spinnerValue, 0, 100, state->spinnerEditMode)) state->spinnerEditMode = !state->spinnerEditMode;
-            GuiSlider(state->controlRecs[GUI_SLIDER], NULL, NULL, &state->sliderValue, 0, 100);
-            GuiSliderBar(state->controlRecs[GUI_SLIDERBAR], NULL, NULL, &state->sliderBarValue, 0, 100);
-            GuiProgressBar(state->controlRecs[GUI_PROGRESSBAR], NULL, NULL, &state->progressBarValue, 0, 100);
-            GuiStatusBar(state->controlRecs[GUI_STATUSBAR], "StatusBar");
-            GuiScrollPanel(state->controlRecs[GUI_SCROLLPANEL], NULL, state->controlRecs[GUI_SCROLLPANEL], &state->scrollPanelScrollOffset, &state->scrollPanelView);
-            GuiListView(state->controlRecs[GUI_LISTVIEW], "ONE;TWO", &state->listViewScrollIndex, &state->listViewActive);
-            GuiColorPicker(state->controlRecs[GUI_COLORPICKER], NULL, &state->colorPickerValue);
-            GuiDummyRec(state->controlRecs[GUI_DUMMYREC], "DummyRec");
-            if (GuiDropdownBox(state->controlRecs[GUI_DROPDOWNBOX], "ONE;TWO;THREE", &state->dropdownBoxActive, state->dropdownBoxEditMode)) state->dropdownBoxEditMode = !state->dropdownBoxEditMode;
+            if (state->previewTarget.id > 0)
+            {
+                // NOTE: Render texture must be flipped vertically (OpenGL coordinates)
+                DrawTextureRec(state->previewTarget.texture, (Rectangle){ 0, 0, (float)state->previewTarget.texture.width, -(float)state->previewTarget.texture.height },
+                    (Vector2){ state->panelBounds.x, state->panelBounds.y + state->containerScrollOffset.y }, WHITE);
+            }
+            else DrawControlsPaletteSamples(state);     // Fallback: Draw samples every frame
 
             // Draw selected control rectangle
             DrawRectangleRec(state->controlRecs[state->selectedControl], Fade(RED, 0.2f));
             DrawRectangleLinesEx(state->controlRecs[state->selectedControl], 1, MAROON);
 
-            GuiUnlock();
-
         EndScissorMode();
         //----------------------------------------------------------------------------------------
     }
 }
 
+// Unload controls samples preview texture
+void UnloadGuiPanelControlsPalette(GuiPanelControlsPaletteState *state)
+{
+    if (state->previewTarget.id > 0) UnloadRenderTexture(state->previewTarget);
+
+    state->previewTarget = (RenderTexture2D){ 0 };
+    state->previewStyleHash = 0;
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get current style hash (properties, font and state)
+// NOTE: FNV-1a hash, all style properties are checked (a few hundred values, cheap enough per frame)
+static unsigned int GetControlsPaletteStyleHash(void)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int control = 0; control < RAYGUI_MAX_CONTROLS; control++)
+    {
+        for (int property = 0; property < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); property++)
+        {
+            hash = (hash ^ (unsigned int)GuiGetStyle(control, property))*16777619u;
+        }
+    }
+
+    Font font = GuiGetFont();
+    hash = (hash ^ font.texture.id)*16777619u;
+    hash = (hash ^ (unsigned int)font.baseSize)*16777619u;
+    hash = (hash ^ (unsigned int)GuiGetState())*16777619u;
+
+    // NOTE: Hash 0 is reserved for preview not drawn
+    return (hash == 0)? 1 : hash;
+}
+
+// Draw palette controls samples at current controls rectangles
+// NOTE: Controls are locked, samples look does not depend on mouse state
+static void DrawControlsPaletteSamples(GuiPanelControlsPaletteState *state)
+{
+    bool locked = GuiIsLocked();
+    GuiLock();
+
+    state->windowBoxActive = !GuiWindowBox(state->controlRecs[GUI_WINDOWBOX], "WindowBox");
+    GuiGroupBox(state->controlRecs[GUI_GROUPBOX], "GroupBox");
+    GuiLine(state->controlRecs[GUI_LINE], NULL);
+    GuiPanel(state->controlRecs[GUI_PANEL], NULL);
+    GuiLabel(state->controlRecs[GUI_LABEL], "Label");
+    state->buttonPressed = GuiButton(state->controlRecs[GUI_BUTTON], "Button");
+    state->labelBtnPressed = GuiLabelButton(state->controlRecs[GUI_LABELBUTTON], "LabelButton");
+    GuiCheckBox(state->controlRecs[GUI_CHECKBOX], "", &state->checkBoxChecked);
+    GuiToggle(state->controlRecs[GUI_TOGGLE], "Toggle", &state->toggleActive);
+    GuiToggleGroup((Rectangle) { state->controlRecs[GUI_TOGGLEGROUP].x, state->controlRecs[GUI_TOGGLEGROUP].y, (state->controlRecs[GUI_TOGGLEGROUP].width - GuiGetStyle(TOGGLE, GROUP_PADDING)*2.0f)/3.0f, state->controlRecs[GUI_TOGGLEGROUP].height }, "ONE;TWO;THREE", &state->toggleGroupActive);
+    GuiComboBox(state->controlRecs[GUI_COMBOBOX], "ONE;TWO;THREE", &state->comboBoxActive);
+    if (GuiTextBox(state->controlRecs[GUI_TEXTBOX], state->textBoxText, 64, state->textBoxEditMode)) state->textBoxEditMode = !state->textBoxEditMode;
+    if (GuiValueBox(state->controlRecs[GUI_VALUEBOX], NULL, &state->valueBoxValue, 0, 100, state->valueBoxEditMode)) state->valueBoxEditMode = !state->valueBoxEditMode;
+    if (GuiSpinner(state->controlRecs[GUI_SPINNER], NULL, &state->spinnerValue, 0, 100, state->spinnerEditMode)) state->spinnerEditMode = !state->spinnerEditMode;
+    GuiSlider(state->controlRecs[GUI_SLIDER], NULL, NULL, &state->sliderValue, 0, 100);
+    GuiSliderBar(state->controlRecs[GUI_SLIDERBAR], NULL, NULL, &state->sliderBarValue, 0, 100);
+    GuiProgressBar(state->controlRecs[GUI_PROGRESSBAR], NULL, NULL, &state->progressBarValue, 0, 100);
+    GuiStatusBar(state->controlRecs[GUI_STATUSBAR], "StatusBar");
+    GuiScrollPanel(state->controlRecs[GUI_SCROLLPANEL], NULL, state->controlRecs[GUI_SCROLLPANEL], &state->scrollPanelScrollOffset, &state->scrollPanelView);
+    GuiListView(state->controlRecs[GUI_LISTVIEW], "ONE;TWO", &state->listViewScrollIndex, &state->listViewActive);
+    GuiColorPicker(state->controlRecs[GUI_COLORPICKER], NULL, &state->colorPickerValue);
+    GuiDummyRec(state->controlRecs[GUI_DUMMYREC], "DummyRec");
+    if (GuiDropdownBox(state->controlRecs[GUI_DROPDOWNBOX], "ONE;TWO;THREE", &state->dropdownBoxActive, state->dropdownBoxEditMode)) state->dropdownBoxEditMode = !state->dropdownBoxEditMode;
+
+    if (!locked) GuiUnlock();
+}
+
 void UpdateControlsPaletteRecs(GuiPanelControlsPaletteState *state)
 {
     state->controlRecs[GUI_WINDOWBOX] = (Rectangle){ state->panelBounds.x + 20, state->panelBounds.y + state->containerScrollOffset.y + 24 + 16, 120, 48 };
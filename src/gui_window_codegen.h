@@ -7,6 +7,7 @@
 *       #include "gui_window_codegen.h"
 *
 *       INIT: GuiWindowCodegenState state = InitGuiWindowCodegen();
+*       CODE: GuiWindowCodegenSetCode(&state, codeText);   // Takes ownership of codeText
 *       DRAW: GuiWindowCodegen(&state);
 *
 *   LICENSE: zlib/libpng
@@ -39,6 +40,25 @@
 #ifndef GUI_WINDOW_CODEGEN_H
 #define GUI_WINDOW_CODEGEN_H
 
+// Code token types for syntax highlighting
+typedef enum {
+    CODE_TOKEN_DEFAULT = 0,
+    CODE_TOKEN_KEYWORD,
+    CODE_TOKEN_STRING,
+    CODE_TOKEN_COMMENT,
+    CODE_TOKEN_NUMBER,
+    CODE_TOKEN_RAYGUI_CALL,
+    CODE_TOKEN_TYPE_COUNT
+} GuiCodeTokenType;
+
+// Code highlight span, text range with a token type
+// NOTE: Spans never cross line breaks, multi-line tokens are split by lines
+typedef struct {
+    unsigned int offset;            // Span start offset into code text
+    unsigned short length;          // Span length in characters
+    unsigned char type;             // Span token type (GuiCodeTokenType)
+} GuiCodeSpan;
+
 typedef struct {
 
     bool windowActive;
@@ -71,8 +91,14 @@ typedef struct {
 
     // Custom state variables
     unsigned char *codeText;        // Generated code string
-    unsigned int codeHeight;        // Maximum height of code block (computed at drawing)
+    unsigned int *codeLineOffsets;  // Code lines start offsets into codeText, codeLineCount + 1 entries (computed on code set)
+    unsigned int codeLineCount;     // Code lines count (computed on code set)
+    unsigned int codeWidth;         // Maximum width of code block (computed on code set)
+    unsigned int codeHeight;        // Maximum height of code block (computed on code set)
+    GuiCodeSpan *codeSpans;         // Code highlight spans, sorted by offset (computed on code set)
+    unsigned int codeSpanCount;     // Code highlight spans count
     Font codeFont;                  // Font used for text drawing
+    float codeCharWidth;            // Font character advance (monospace font)
 
     unsigned char *customTemplate;  // Custom template loaded
     bool customTemplateLoaded;      // Custom template loaded flag
@@ -86,7 +112,8 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#define GUI_WINDOW_CODEGEN_LINE_HEIGHT          20      // Code line height in pixels
+#define GUI_WINDOW_CODEGEN_MAX_LINE_CHARS      512      // Maximum characters drawn per line (visible columns)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -108,6 +135,7 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 GuiWindowCodegenState InitGuiWindowCodegen(void);
 void GuiWindowCodegen(GuiWindowCodegenState *state);
+void GuiWindowCodegenSetCode(GuiWindowCodegenState *state, unsigned char *codeText);  // Set code text (previous one freed), NULL to clear
 
 #ifdef __cplusplus
 }
@@ -126,6 +154,16 @@ void GuiWindowCodegen(GuiWindowCodegenState *state);
 
 #include "font_gohufont.h"
 
+#include <string.h>             // Required for: strncmp(), memcpy()
+#include <ctype.h>              // Required for: isalpha(), isalnum()
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void LoadCodeFont(GuiWindowCodegenState *state);         // Load code font (on first use)
+static void GenCodeSpans(GuiWindowCodegenState *state);         // Generate code highlight spans (tokenize code text)
+static unsigned int GetCodeSpanIndex(const GuiCodeSpan *spans, unsigned int count, unsigned int offset);    // Get first span ending after offset (binary search)
+
 GuiWindowCodegenState InitGuiWindowCodegen(void)
 {
     GuiWindowCodegenState state = { 0 };
@@ -157,8 +195,14 @@ GuiWindowCodegenState InitGuiWindowCodegen(void)
 
     // Custom variables initialization
     state.codeText = NULL;
+    state.codeLineOffsets = NULL;
+    state.codeLineCount = 0;
+    state.codeWidth = 0;
     state.codeHeight = 0;
-    state.codeFont = LoadFont_Gohufont();   // Font embedded (font_gohufont.h)
+    state.codeSpans = NULL;
+    state.codeSpanCount = 0;
+    state.codeFont = (Font){ 0 };           // Loaded on first use, LoadCodeFont()
+    state.codeCharWidth = 0.0f;
 
     state.customTemplate = NULL;            // Custom template loaded
     state.customTemplateLoaded = false;     // Custom template loaded flag
@@ -170,6 +214,8 @@ void GuiWindowCodegen(GuiWindowCodegenState *state)
 {
     if (state->windowActive)
     {
+        LoadCodeFont(state);
+
         state->windowBounds = (Rectangle){ GetScreenWidth()/2.0f - 1024/2, GetScreenHeight()/2.0f - 640/2, 1024, 640 };
         state->windowActive = !GuiWindowBox(state->windowBounds, "#7#Code Generation Window");
 
@@ -209,36 +255,297 @@ void GuiWindowCodegen(GuiWindowCodegenState *state)
         // Draw generated code
         Rectangle codePanel = { state->windowBounds.x + 10, state->windowBounds.y + 35, 745, 595 };
         Rectangle view = { 0 };
-        GuiScrollPanel(codePanel, NULL, (Rectangle){ codePanel.x, codePanel.y, codePanel.width*2, (float)state->codeHeight }, &state->codePanelScrollOffset, &view);
+        GuiScrollPanel(codePanel, NULL, (Rectangle){ codePanel.x, codePanel.y, (float)state->codeWidth, (float)state->codeHeight }, &state->codePanelScrollOffset, &view);
 
         if (state->codeText != NULL)
         {
-            BeginScissorMode((int)view.x, (int)view.y, (int)view.width, (int)view.height);
-                unsigned int linesCounter = 0;
-                unsigned char *currentLine = state->codeText;
+            // Get visible lines range, lines index computed on code set
+            // NOTE: All lines share the same height, no need to scan code text
+            int firstLine = (int)((-state->codePanelScrollOffset.y - 8)/GUI_WINDOW_CODEGEN_LINE_HEIGHT);
+            if (firstLine < 0) firstLine = 0;
+            int lastLine = firstLine + (int)(view.height/GUI_WINDOW_CODEGEN_LINE_HEIGHT) + 2;
+            if (lastLine > (int)state->codeLineCount) lastLine = (int)state->codeLineCount;
+
+            // Get visible columns range, only visible characters are copied for drawing
+            int firstColumn = (int)(-state->codePanelScrollOffset.x/state->codeCharWidth);
+            if (firstColumn < 0) firstColumn = 0;
+            int columnCount = (int)(view.width/state->codeCharWidth) + 2;
+            if (columnCount > (GUI_WINDOW_CODEGEN_MAX_LINE_CHARS - 1)) columnCount = GUI_WINDOW_CODEGEN_MAX_LINE_CHARS - 1;
+
+            char lineText[GUI_WINDOW_CODEGEN_MAX_LINE_CHARS] = { 0 };
+
+            // Code colors by token type, aligned with current style
+            Color codeColors[CODE_TOKEN_TYPE_COUNT] = {
+                GetColor(GuiGetStyle(TEXTBOX, TEXT_COLOR_NORMAL)),      // CODE_TOKEN_DEFAULT
+                GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_PRESSED)),   // CODE_TOKEN_KEYWORD
+                GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)),     // CODE_TOKEN_STRING
+                GetColor(GuiGetStyle(TEXTBOX, TEXT_COLOR_DISABLED)),    // CODE_TOKEN_COMMENT
+                GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_FOCUSED)),   // CODE_TOKEN_NUMBER
+                GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_FOCUSED)),     // CODE_TOKEN_RAYGUI_CALL
+            };
 
-                while (currentLine)
+            BeginScissorMode((int)view.x, (int)view.y, (int)view.width, (int)view.height);
+                for (int i = firstLine; i < lastLine; i++)
                 {
-                    char *nextLine = strchr(currentLine, '\n');
-                    if (nextLine) *nextLine = '\0';     // Temporaly terminating the current line
+                    // NOTE: Line length does not include the line break
+                    int lineStart = (int)state->codeLineOffsets[i];
+                    int lineLength = (int)state->codeLineOffsets[i + 1] - lineStart - 1;
+                    if ((lineLength > 0) && (state->codeText[lineStart + lineLength - 1] == '\r')) lineLength--;
+
+                    if (lineLength <= firstColumn) continue;
 
-                    // Only draw lines inside text panel
-                    if (((state->codePanelScrollOffset.y + 20*linesCounter) >= -40) &&
-                        ((state->codePanelScrollOffset.y + 20*linesCounter) < (codePanel.height - 2)))
+                    int length = lineLength - firstColumn;
+                    if (length > columnCount) length = columnCount;
+
+                    // Draw visible line range split in segments by highlight spans
+                    // NOTE: Spans are sorted by offset, first span intersecting visible range is found by binary search
+                    unsigned int position = lineStart + firstColumn;
+                    unsigned int end = position + length;
+                    unsigned int span = GetCodeSpanIndex(state->codeSpans, state->codeSpanCount, position);
+
+                    while (position < end)
                     {
-                        DrawTextEx(state->codeFont, currentLine, (Vector2) { codePanel.x + state->codePanelScrollOffset.x + 10, codePanel.y + state->codePanelScrollOffset.y + 20*linesCounter + 8 }, state->codeFont.baseSize, 1, GetColor(GuiGetStyle(TEXTBOX, TEXT_COLOR_NORMAL)));
-                    }
+                        unsigned int segmentEnd = end;
+                        int type = CODE_TOKEN_DEFAULT;
 
-                    if (nextLine) *nextLine = '\n';     // Restore newline-char, just to be tidy
-                    currentLine = nextLine? (nextLine + 1) : NULL;
+                        if ((span < state->codeSpanCount) && (state->codeSpans[span].offset <= position))
+                        {
+                            // Segment inside current span
+                            type = state->codeSpans[span].type;
+                            if ((state->codeSpans[span].offset + state->codeSpans[span].length) < segmentEnd) segmentEnd = state->codeSpans[span].offset + state->codeSpans[span].length;
+                            span++;
+                        }
+                        else if ((span < state->codeSpanCount) && (state->codeSpans[span].offset < segmentEnd)) segmentEnd = state->codeSpans[span].offset;
 
-                    linesCounter++;
+                        memcpy(lineText, state->codeText + position, segmentEnd - position);
+                        lineText[segmentEnd - position] = '\0';
+
+                        DrawTextEx(state->codeFont, lineText, (Vector2){ codePanel.x + state->codePanelScrollOffset.x + 10 + (position - lineStart)*state->codeCharWidth,
+                            codePanel.y + state->codePanelScrollOffset.y + GUI_WINDOW_CODEGEN_LINE_HEIGHT*i + 8 }, (float)state->codeFont.baseSize, 1, codeColors[type]);
+
+                        position = segmentEnd;
+                    }
                 }
             EndScissorMode();
+        }
+    }
+}
+
+// Set code text to be displayed, lines index and code size are computed once here
+// NOTE: Window takes ownership of provided codeText (expected to be allocated with RL_MALLOC/RL_CALLOC),
+// previous code text is freed, NULL can be provided to just clear current code
+void GuiWindowCodegenSetCode(GuiWindowCodegenState *state, unsigned char *codeText)
+{
+    if (state->codeText != codeText) RL_FREE(state->codeText);
+    RL_FREE(state->codeLineOffsets);
+    RL_FREE(state->codeSpans);
+
+    state->codeText = codeText;
+    state->codeLineOffsets = NULL;
+    state->codeLineCount = 0;
+    state->codeWidth = 0;
+    state->codeHeight = 0;
+    state->codeSpans = NULL;
+    state->codeSpanCount = 0;
+
+    if (codeText != NULL)
+    {
+        // Count lines to allocate lines index
+        unsigned int lineCount = 1;
+        for (unsigned char *ptr = codeText; *ptr != '\0'; ptr++) if (*ptr == '\n') lineCount++;
+
+        // NOTE: One additional offset is stored (text end) to compute last line length as any other line
+        state->codeLineOffsets = (unsigned int *)RL_CALLOC(lineCount + 1, sizeof(unsigned int));
+
+        unsigned int line = 0;
+        unsigned int offset = 0;
+        unsigned int maxLineLength = 0;
+
+        state->codeLineOffsets[0] = 0;
+
+        for (; codeText[offset] != '\0'; offset++)
+        {
+            if (codeText[offset] == '\n')
+            {
+                if ((offset - state->codeLineOffsets[line]) > maxLineLength) maxLineLength = offset - state->codeLineOffsets[line];
+
+                line++;
+                state->codeLineOffsets[line] = offset + 1;
+            }
+        }
+
+        if ((offset - state->codeLineOffsets[line]) > maxLineLength) maxLineLength = offset - state->codeLineOffsets[line];
+        state->codeLineOffsets[lineCount] = offset + 1;     // Text end, as if followed by a line break
+
+        LoadCodeFont(state);    // Code font character advance required
+
+        state->codeLineCount = lineCount;
+        state->codeWidth = (unsigned int)(maxLineLength*state->codeCharWidth) + 20;
+        state->codeHeight = GUI_WINDOW_CODEGEN_LINE_HEIGHT*lineCount;
+
+        // Tokenize code once for syntax highlighting
+        GenCodeSpans(state);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// C keywords and common types highlighted
+// NOTE: List must be kept sorted (strcmp order), it is searched with binary search
+static const char *codeKeywords[] = {
+    "NULL", "bool", "break", "case", "char", "const", "continue", "default", "define", "do", "double",
+    "elif", "else", "endif", "enum", "extern", "false", "float", "for", "if", "ifdef", "ifndef", "include",
+    "inline", "int", "long", "return", "short", "signed", "sizeof", "static", "struct", "switch",
+    "true", "typedef", "undef", "union", "unsigned", "void", "volatile", "while"
+};
+
+// Check if a text range is a C keyword
+static bool IsCodeKeyword(const unsigned char *text, int length)
+{
+    int first = 0;
+    int last = sizeof(codeKeywords)/sizeof(codeKeywords[0]) - 1;
+
+    while (first <= last)
+    {
+        int middle = (first + last)/2;
+        int result = strncmp((const char *)text, codeKeywords[middle], length);
+        if ((result == 0) && (codeKeywords[middle][length] != '\0')) result = -1;
+
+        if (result == 0) return true;
+        else if (result < 0) last = middle - 1;
+        else first = middle + 1;
+    }
+
+    return false;
+}
+
+// Add code span to spans array, growing it if required
+// NOTE: Spans are split at line breaks and at maximum span length
+static void AddCodeSpan(GuiWindowCodegenState *state, unsigned int *capacity, unsigned int offset, unsigned int length, int type)
+{
+    unsigned int end = offset + length;
+
+    while (offset < end)
+    {
+        // Skip line breaks, spans never include them
+        if ((state->codeText[offset] == '\n') || (state->codeText[offset] == '\r')) { offset++; continue; }
+
+        unsigned int spanEnd = offset;
+        while ((spanEnd < end) && (state->codeText[spanEnd] != '\n') && (state->codeText[spanEnd] != '\r') && ((spanEnd - offset) < 0xffff)) spanEnd++;
+
+        if (state->codeSpanCount >= *capacity)
+        {
+            *capacity = (*capacity == 0)? 1024 : *capacity*2;
+            state->codeSpans = (GuiCodeSpan *)RL_REALLOC(state->codeSpans, *capacity*sizeof(GuiCodeSpan));
+        }
+
+        state->codeSpans[state->codeSpanCount].offset = offset;
+        state->codeSpans[state->codeSpanCount].length = (unsigned short)(spanEnd - offset);
+        state->codeSpans[state->codeSpanCount].type = (unsigned char)type;
+        state->codeSpanCount++;
+
+        offset = spanEnd;
+    }
+}
+
+// Load code font (on first use)
+// NOTE: Font texture is only uploaded when code is set or window shown, not on window init
+static void LoadCodeFont(GuiWindowCodegenState *state)
+{
+    if (state->codeFont.texture.id > 0) return;
+
+    state->codeFont = LoadFont_Gohufont();  // Font embedded (font_gohufont.h)
+
+    // NOTE: Code font is monospace, all characters share the same advance
+    state->codeCharWidth = MeasureTextEx(state->codeFont, "W", (float)state->codeFont.baseSize, 1).x + 1;
+}
+
+// Generate code highlight spans, tokenizing code text in a single pass
+// NOTE: Only highlighted tokens generate spans, default text is not stored
+static void GenCodeSpans(GuiWindowCodegenState *state)
+{
+    const unsigned char *text = state->codeText;
+    unsigned int capacity = 0;
+    unsigned int i = 0;
+    bool lineStart = true;      // Only whitespace found in current line (preprocessor directives check)
 
-            state->codeHeight = 20*linesCounter;
+    while (text[i] != '\0')
+    {
+        unsigned char c = text[i];
+        unsigned int start = i;
+
+        if ((c == '/') && (text[i + 1] == '/'))             // Line comment
+        {
+            while ((text[i] != '\0') && (text[i] != '\n')) i++;
+            AddCodeSpan(state, &capacity, start, i - start, CODE_TOKEN_COMMENT);
+        }
+        else if ((c == '/') && (text[i + 1] == '*'))        // Block comment (multi-line)
+        {
+            i += 2;
+            while ((text[i] != '\0') && !((text[i] == '*') && (text[i + 1] == '/'))) i++;
+            if (text[i] != '\0') i += 2;
+            AddCodeSpan(state, &capacity, start, i - start, CODE_TOKEN_COMMENT);
+        }
+        else if ((c == '"') || (c == '\''))                 // String or char literal
+        {
+            i++;
+            while ((text[i] != '\0') && (text[i] != c) && (text[i] != '\n'))
+            {
+                if ((text[i] == '\\') && (text[i + 1] != '\0')) i++;
+                i++;
+            }
+            if (text[i] == c) i++;
+            AddCodeSpan(state, &capacity, start, i - start, CODE_TOKEN_STRING);
+        }
+        else if (((c >= '0') && (c <= '9')) || ((c == '.') && (text[i + 1] >= '0') && (text[i + 1] <= '9')))   // Number
+        {
+            while (isalnum(text[i]) || (text[i] == '.')) i++;
+            AddCodeSpan(state, &capacity, start, i - start, CODE_TOKEN_NUMBER);
+        }
+        else if ((c == '#') && lineStart)                   // Preprocessor directive
+        {
+            i++;
+            while ((text[i] == ' ') || (text[i] == '\t')) i++;
+            unsigned int wordStart = i;
+            while (isalpha(text[i])) i++;
+            if (IsCodeKeyword(text + wordStart, i - wordStart)) AddCodeSpan(state, &capacity, start, i - start, CODE_TOKEN_KEYWORD);
         }
+        else if (isalpha(c) || (c == '_'))                  // Identifier, keyword or raygui call
+        {
+            while (isalnum(text[i]) || (text[i] == '_')) i++;
+
+            if (IsCodeKeyword(text + start, i - start)) AddCodeSpan(state, &capacity, start, i - start, CODE_TOKEN_KEYWORD);
+            else if (((i - start) > 3) && (strncmp((const char *)text + start, "Gui", 3) == 0))
+            {
+                unsigned int next = i;
+                while (text[next] == ' ') next++;
+                if (text[next] == '(') AddCodeSpan(state, &capacity, start, i - start, CODE_TOKEN_RAYGUI_CALL);
+            }
+        }
+        else i++;
+
+        if (text[start] == '\n') lineStart = true;
+        else if ((text[start] != ' ') && (text[start] != '\t') && (text[start] != '\r')) lineStart = false;
     }
 }
 
+// Get index of first span ending after provided offset (binary search)
+// NOTE: Returns count if no span found
+static unsigned int GetCodeSpanIndex(const GuiCodeSpan *spans, unsigned int count, unsigned int offset)
+{
+    unsigned int first = 0;
+    unsigned int last = count;
+
+    while (first < last)
+    {
+        unsigned int middle = first + (last - first)/2;
+
+        if ((spans[middle].offset + spans[middle].length) <= offset) first = middle + 1;
+        else last = middle;
+    }
+
+    return first;
+}
+
 #endif // GUI_WINDOW_CODEGEN_IMPLEMENTATION
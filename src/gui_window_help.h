@@ -123,6 +123,7 @@ static const char *helpLines[] = {
     "LCTRL + Z - Undo Action",
     "LCTRL + Y - Redo Action",
     "LALT + S - Toggle snap to grid mode",
+    "LALT + G - Toggle smart guides mode",
     "RALT + ARROWS - Setup grid spacing",
 
     "-General Edition",
@@ -132,6 +133,11 @@ static const char *helpLines[] = {
     "LCTRL + LSHIFT + ARROWS - Scale control smooth",
     "LCTRL + D - Duplicate control/anchor",
     "DEL - Delete control/anchor/tracemap",
+    "LCTRL + A - Select all controls",
+    "RMB (drag) - Select controls in box",
+    "LCTRL/LSHIFT + LMB - Toggle control selection",
+    "LALT + ARROWS - Align selected controls",
+    "LALT + H/V - Distribute selected controls",
 
     "-Control Edition",
     "T - Control text editing",
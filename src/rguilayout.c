@@ -169,6 +169,9 @@
 #define GUI_WINDOW_CODEGEN_IMPLEMENTATION
 #include "gui_window_codegen.h"             // GUI: Code Generation Window
 
+#define FILE_JOBS_IMPLEMENTATION
+#include "file_jobs.h"                      // File jobs: loading/saving on worker threads
+
 // raygui embedded styles
 // NOTE: Included in the same order as selector
 #define MAX_GUI_STYLES_AVAILABLE   12       // NOTE: Included light style
@@ -197,6 +200,15 @@
 #include <string.h>                         // Required for: strcpy(), strcat(), strlen()
 #include <stdio.h>                          // Required for: FILE, fopen(), fclose()...
 #include <ctype.h>                          // Required for: toupper(), tolower()
+#include <math.h>                           // Required for: roundf(), fabsf()
+
+// Watch mode required libraries (SUPPORT_WATCH_MODE)
+#if defined(PLATFORM_DESKTOP) && defined(__linux__)
+    #include <sys/inotify.h>                // Required for: inotify_init1(), inotify_add_watch()
+    #include <poll.h>                       // Required for: poll()
+    #include <unistd.h>                     // Required for: read(), close()
+    #include <errno.h>                      // Required for: errno, EINTR
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -225,7 +237,43 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
 
 #define MAX_ICONS_AVAILABLE        220      // Max raygui icons displayed on icon selector
 
-#define MAX_ELEMENTS_SELECTION      64      // Max elements selected
+#define SMART_GUIDES_SNAP_DISTANCE   6      // Smart guides snap distance in pixels
+#define MAX_SMART_GUIDES_EDGES      (MAX_GUI_CONTROLS*3 + MAX_ANCHOR_POINTS)    // Smart guides edges per axis (controls min/center/max + anchors)
+
+#define TRACEMAP_TILE_SIZE         512      // Tracemap tile size in pixels (tile texture size)
+#define TRACEMAP_MAX_LEVELS         16      // Tracemap max mipmap levels
+#define TRACEMAP_MAX_IMAGE_SIZE   4096      // Tracemap max level 0 size in pixels, bigger images are downscaled (CPU levels <= ~85 MB)
+#define TRACEMAP_MAX_TILES          64      // Tracemap max tiles textures resident on GPU (64*512*512*4 = 64 MB)
+#define TRACEMAP_MAX_TILE_UPLOADS    4      // Tracemap max tiles uploaded to GPU per frame
+
+// Load all embedded styles on initialization, style switching never decompresses or uploads fonts
+// NOTE: Styles are cached on first usage anyway, prewarm moves that cost to startup
+//#define SUPPORT_STYLES_CACHE_PREWARM
+
+// Report startup stages timing (window, layout, editor init, first frame), useful to review time-to-first-frame
+// NOTE: Undo levels, code font and info windows are initialized on first use, not on startup,
+// report is printed to stdout on any build (LOG() is only available on debug builds)
+//#define SUPPORT_STARTUP_TIMING
+
+// Command line watch mode: process stays resident and regenerates outputs when input files change
+// NOTE: Only available on Linux (inotify), on other platforms outputs are generated once
+#if defined(PLATFORM_DESKTOP) && defined(__linux__)
+    #define SUPPORT_WATCH_MODE
+#endif
+
+#define MAX_CLI_INPUT_FILES         32      // Maximum input files on command line
+#define MAX_OUTPUT_DEPENDENCIES      3      // Maximum files required to generate one output (input + template or font + charmap)
+#define WATCH_DEBOUNCE_TIME        100      // Watch mode: time without new changes before regenerating outputs (ms)
+
+// Draw background grid with a fragment shader on a single quad, cost does not depend on grid density
+// NOTE: GuiGrid() is used if not defined or if shader can not be compiled
+#define SUPPORT_SHADER_GRID
+
+#if defined(PLATFORM_WEB)
+    #define GRID_SHADER_HEADER  "#version 100\n#ifdef GL_FRAGMENT_PRECISION_HIGH\nprecision highp float;\n#else\nprecision mediump float;\n#endif\nvarying vec2 fragTexCoord;\n#define FRAG_COLOR gl_FragColor\n"
+#else
+    #define GRID_SHADER_HEADER  "#version 330\nin vec2 fragTexCoord;\nout vec4 finalColor;\n#define FRAG_COLOR finalColor\n"
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -233,10 +281,78 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
 
 // NOTE: Most of the structs are defined in "rguilayout.h"
 
+// Controls alignment type, used on bulk alignment
+typedef enum {
+    CONTROLS_ALIGN_LEFT = 0,
+    CONTROLS_ALIGN_RIGHT,
+    CONTROLS_ALIGN_TOP,
+    CONTROLS_ALIGN_BOTTOM
+} ControlsAlignment;
+
+// Selected control sorting item, used on bulk distribution
+typedef struct {
+    int index;          // Control index in layout
+    float position;     // Control screen position (x or y)
+} SelectionSortItem;
+
+// Smart guide edge type
+typedef struct {
+    float position;     // Edge position: x for vertical edges, y for horizontal edges
+    float min;          // Edge span start: y for vertical edges, x for horizontal edges
+    float max;          // Edge span end
+} GuideEdge;
+
+// Smart guides type
+// NOTE: Edges and centers of not selected controls (and anchors) are sorted by position once per
+// drag/scale operation, snapping queries use binary search, O(log n) per frame
+typedef struct {
+    GuideEdge edgesX[MAX_SMART_GUIDES_EDGES];   // Vertical edges, sorted by x position
+    GuideEdge edgesY[MAX_SMART_GUIDES_EDGES];   // Horizontal edges, sorted by y position
+    int edgeCountX;                             // Vertical edges count
+    int edgeCountY;                             // Horizontal edges count
+    bool ready;                                 // Edges built for current drag/scale operation
+    bool snappedX;                              // Vertical guide snapped (last query)
+    bool snappedY;                              // Horizontal guide snapped (last query)
+    GuideEdge guideX;                           // Vertical guide line (last query), span includes snapped rectangle
+    GuideEdge guideY;                           // Horizontal guide line (last query), span includes snapped rectangle
+} SmartGuides;
+
+// Visual style cache type
+// NOTE: Embedded styles properties and font are cached on first load, avoiding
+// font atlas decompression and texture upload on every style switch
+typedef struct {
+    bool loaded;                    // Style has been loaded and cached
+    unsigned int props[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)];  // Style properties table
+    Font font;                      // Style font (texture owned by cache)
+} VisualStyleCache;
+
+// Tracemap tile type
+// NOTE: Tiles are uploaded on demand, least recently drawn tile slot is reused
+typedef struct {
+    Texture2D texture;              // Tile texture (id == 0 for free slot)
+    int level;                      // Tile mipmap level
+    int x;                          // Tile column in level
+    int y;                          // Tile row in level
+    unsigned int lastUsed;          // Last draw frame the tile was used
+} TracemapTile;
+
 // Tracemap type
+// NOTE: Image is kept on CPU as a chain of mipmap levels, only the tiles covering
+// the visible region at the level required by current tracemap scale are uploaded to GPU
+// Level 0 is limited to TRACEMAP_MAX_IMAGE_SIZE, so CPU memory is bounded to 4/3 of a
+// 4096x4096 RGBA8 image (~85 MB) plus 64 MB of GPU tiles, whatever the image size
+// (decoded source image is only kept while loading, before downscaling)
 typedef struct {
-    Texture2D texture;
+    Image levels[TRACEMAP_MAX_LEVELS];      // Image mipmap levels (CPU), level 0 is full resolution (up to TRACEMAP_MAX_IMAGE_SIZE)
+    int levelCount;                         // Image mipmap levels count
+    int width;                              // Image width (original size)
+    int height;                             // Image height (original size)
+    Texture2D preview;                      // Last mipmap level texture (fits in one tile), always resident
+    TracemapTile tiles[TRACEMAP_MAX_TILES]; // Tiles textures cache (GPU)
+    unsigned int frameCounter;              // Draw frames counter, used for tiles eviction
+
     Rectangle rec;
+    bool loaded;
 
     bool focused;
     bool selected;
@@ -245,6 +361,39 @@ typedef struct {
     float alpha;
 } Tracemap;
 
+// Background grid type
+// NOTE: Grid is drawn by a fragment shader on a single quad, texture coordinates
+// map the quad to grid size in pixels, lines are computed per fragment
+typedef struct {
+    Shader shader;                  // Grid fragment shader
+    Texture2D texture;              // White 1x1 texture, quad texture coordinates provider
+    int sizeLoc;                    // Shader location: grid size in pixels (vec2)
+    int spacingLoc;                 // Shader location: grid subdivision spacing in pixels (float)
+    int subdivisionsLoc;            // Shader location: grid subdivisions per major line (float)
+    int colorLoc;                   // Shader location: grid lines color (vec4)
+    bool ready;                     // Grid shader ready to be used
+} BackgroundGrid;
+
+// Tracemap loading job data
+typedef struct {
+    Tracemap tracemap;              // Tracemap image levels, loaded on worker thread
+    Vector2 position;               // Tracemap position once loaded
+    Vector2 pivot;                  // Tracemap position pivot, normalized to tracemap size
+} TracemapJobData;
+
+// Editor state references, required by file jobs completion callbacks
+// NOTE: Completion callbacks are called on main thread by ProcessFileJobs()
+typedef struct {
+    GuiLayout *layout;              // Current layout
+    GuiLayout *undoLayouts;         // Undo levels
+    int *currentUndoIndex;          // Undo current level index
+    int *firstUndoIndex;            // Undo first level index
+    int *lastUndoIndex;             // Undo last level index
+    GuiLayoutSelection *selection;  // Controls selection
+    Tracemap *tracemap;             // Tracemap
+    bool *tracemapLoaded;           // Main toolbar tracemap loaded state
+} EditorState;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -258,21 +407,100 @@ static char outFileName[512] = { 0 };       // Output file name (required for fi
 
 static bool saveChangesRequired = false;    // Flag to notice save changes are required
 
+static VisualStyleCache styleCache[MAX_GUI_STYLES_AVAILABLE] = { 0 };   // Embedded visual styles cache
+
+#if defined(SUPPORT_SHADER_GRID)
+// Background grid fragment shader
+// NOTE: 1 pixel lines, same look as GuiGrid(): minor lines alpha 0.15f, major lines alpha 0.6f
+static const char *gridShaderCode = GRID_SHADER_HEADER
+    "uniform vec2 gridSize;\n"
+    "uniform float gridSpacing;\n"
+    "uniform float gridSubdivisions;\n"
+    "uniform vec4 gridColor;\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 position = floor(fragTexCoord*gridSize);\n"
+    "    vec2 line = step(mod(position, gridSpacing), vec2(0.5));\n"
+    "    vec2 major = line*step(mod(floor(position/gridSpacing), gridSubdivisions), vec2(0.5));\n"
+    "    float alpha = max(max(line.x, line.y)*0.15, max(major.x, major.y)*0.6);\n"
+    "    FRAG_COLOR = vec4(gridColor.rgb, gridColor.a*alpha);\n"
+    "}\n";
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(PLATFORM_DESKTOP)
 static void ShowCommandLineInfo(void);                      // Show command line usage info
 static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+static bool GenerateOutputFile(const char *inFileName, const char *outFileName, const char *templateFileName, const char *depFileName);  // Generate output file from input file (.rgl -> .c/.h, .rgs -> .rgs)
+static int GetOutputDependencies(const char *inFileName, const char *templateFileName, char (*depFileNames)[512]);  // Get files required to generate output from input file
+#if defined(SUPPORT_WATCH_MODE)
+static void WatchOutputFiles(char (*inFileNames)[512], char (*outFileNames)[512], int fileCount, const char *templateFileName, const char *depFileName);  // Regenerate outputs on input files changes
+#endif
 #endif
 
 // Init/Load/Save/Export data functions
-static GuiLayout *LoadLayout(const char *fileName);         // Load raygui layout: empty (NULL) or from file (.rgl)
+static GuiLayout *LoadLayout(const char *fileName);         // Load raygui layout: empty (NULL) or from file (.rgl), NULL on failure
 static void UnloadLayout(GuiLayout *layout);                // Unload raygui layout
 static void ResetLayout(GuiLayout *layout);                 // Reset layout to default values
-static void SaveLayout(GuiLayout *layout, const char *fileName);     // Save raygui layout as text file (.rgl)
+static bool SaveLayout(GuiLayout *layout, const char *fileName);     // Save raygui layout as text file (.rgl)
+static GuiLayout *CopyLayout(const GuiLayout *layout);      // Copy layout, anchors references remapped to copy
+#if defined(PLATFORM_DESKTOP)
+static bool ExportStyleAsBinary(const char *fileName, const char *outFileName);  // Export text style file as binary style file (.rgs)
+static bool ExportDependencyFile(const char *fileName, const char *targetFileName, const char **depFileNames, int depCount);   // Export Makefile-syntax dependency file (.d)
+#endif
+
+// Visual styles functions
+static void LoadVisualStyle(int style);                     // Load embedded visual style (cached after first load)
+static void UnloadVisualStylesCache(void);                  // Unload embedded visual styles cache (fonts)
+
+static bool LoadTracemapLevels(Tracemap *tracemap, const char *fileName);   // Load tracemap image as mipmap levels (CPU only, no GPU upload)
+static void UnloadTracemap(Tracemap *tracemap);                         // Unload tracemap image levels and tiles textures
+static void DrawTracemap(Tracemap *tracemap, Color tint);               // Draw tracemap visible tiles at level required by current scale
+
+static BackgroundGrid LoadBackgroundGrid(void);                         // Load background grid shader
+static void UnloadBackgroundGrid(BackgroundGrid *grid);                 // Unload background grid shader
+static void DrawBackgroundGrid(BackgroundGrid *grid, Rectangle bounds, int spacing, int subdivisions);  // Draw background grid (single quad if shader ready)
+
+// File jobs callbacks
+// NOTE: Process callbacks are called on worker threads, completion callbacks on main thread
+static void ProcessLoadLayoutJob(FileJob *job);             // Load layout file
+static void CompleteLoadLayoutJob(FileJob *job);            // Replace editor layout with loaded one
+static void ProcessSaveLayoutJob(FileJob *job);             // Save layout copy as text file
+static void ProcessSaveTextJob(FileJob *job);               // Save text (code) file
+static void CompleteSaveJob(FileJob *job);                  // Check saving result and free saved data
+static void ProcessLoadTracemapJob(FileJob *job);           // Load tracemap image levels
+static void CompleteLoadTracemapJob(FileJob *job);          // Replace editor tracemap with loaded one
+
+static void ResetUndoLayouts(GuiLayout *undoLayouts, int *currentUndoIndex, int *firstUndoIndex, int *lastUndoIndex, const GuiLayout *layout);    // Reset undo levels to current layout
+static bool PushUndoLayout(GuiLayout *undoLayouts, int *currentUndoIndex, int *firstUndoIndex, int *lastUndoIndex, const GuiLayout *layout);  // Record a new undo level (if layout changed)
 
 static bool IsFileNameValid(const char *fileName);          // Check if fileName is valid for the platform/OS
+static bool IsRecContainedInRec(Rectangle container, Rectangle rec);    // Check if a rectangle is contained within another
+static Rectangle GetControlScreenRec(const GuiLayoutControl *control);  // Get control rectangle in screen space (anchor offset considered)
+
+// Layout controls selection functions
+static void ClearSelection(GuiLayoutSelection *selection);                  // Clear selection, O(1) on dense list
+static bool IsControlSelected(const GuiLayoutSelection *selection, int index);  // Check if control slot is selected, O(1)
+static void SelectControl(GuiLayoutSelection *selection, int index);        // Add control slot to selection
+static void UnselectControl(GuiLayoutSelection *selection, int index);      // Remove control slot from selection
+static void ToggleControlSelection(GuiLayoutSelection *selection, int index);   // Toggle control slot selection state
+static void SwapSelectionSlots(GuiLayoutSelection *selection, int indexA, int indexB);  // Update selection on controls order swap
+
+// Layout controls bulk edition functions
+// NOTE: All operations run over selected controls in a single pass
+static void MoveSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, float offsetX, float offsetY);  // Move selected controls
+static void ResizeSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, float offsetWidth, float offsetHeight);  // Resize selected controls
+static void AlignSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, int alignment);   // Align selected controls to selection bounds
+static void DistributeSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, bool vertical);  // Distribute selected controls with equal spacing
+static void LinkSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, GuiAnchorPoint *anchor);   // Link selected controls to anchor (anchor[0] to unlink)
+static bool DuplicateSelectedControls(GuiLayout *layout, GuiLayoutSelection *selection);    // Duplicate selected controls, duplicates get selected
+
+// Smart guides functions
+static void BuildSmartGuides(SmartGuides *guides, const GuiLayout *layout, const GuiLayoutSelection *selection);    // Build sorted edges of not selected controls and anchors
+static Vector2 GetSmartGuidesSnap(SmartGuides *guides, Rectangle rec, bool resize);    // Get offset to snap rectangle edges to nearest guides
+static void DeleteSelectedControls(GuiLayout *layout, GuiLayoutSelection *selection);       // Delete selected controls, layout controls compacted
 
 //----------------------------------------------------------------------------------
 // Program main entry point
@@ -322,6 +550,19 @@ int main(int argc, char *argv[])
     SetWindowMinSize(1280, 720);
     SetExitKey(0);
 
+#if defined(SUPPORT_STARTUP_TIMING)
+    double startupTimeWindow = GetTime();   // Startup time: window and graphic device ready
+    double startupTimeLayout = 0.0;         // Startup time: initial layout loaded
+    double startupTimeEditor = 0.0;         // Startup time: editor state and GUI initialized
+    bool startupTimingReported = false;
+#endif
+
+#if defined(SUPPORT_STYLES_CACHE_PREWARM)
+    // Load all embedded styles into cache and get back to default style
+    for (int i = 1; i < MAX_GUI_STYLES_AVAILABLE; i++) LoadVisualStyle(i);
+    LoadVisualStyle(0);
+#endif
+
     // Code font generation for embedding
     // WARNING: It requires SUPPORT_FILEFORMAT_TTF enabled by raylib
     //Font codeFont = LoadFontEx("resources/gohufont-14.ttf", 14, NULL, 0);
@@ -339,6 +580,10 @@ int main(int argc, char *argv[])
     int moveFrameCounter = 0;               // Movement frames counter
     int moveFrameSpeed = 1;                 // Movement speed per frame
 
+    // Smart guides variables
+    bool smartGuidesActive = true;          // Snap dragged/scaled controls to other controls edges and anchors
+    SmartGuides smartGuides = { 0 };        // Smart guides edges, built on drag/scale start
+
     // Control edit modes
     // NOTE: [E] - Exclusive mode operation, all other modes blocked
     bool dragMoveMode = false;              // [E] Control drag mode
@@ -377,11 +622,10 @@ int main(int argc, char *argv[])
     Vector2 prevPosition = { 0 };
 
     // Multiselection variables
-    bool multiSelectMode = false;           // [E] Multiselection mode
-    Rectangle multiSelectRec = { 0 };
-    //Vector2 multiSelectStartPos = { 0 };
-    //int multiSelectControls[MAX_ELEMENTS_SELECTION] = { -1 };
-    //int multiSelectCount = 0;
+    bool multiSelectMode = false;           // [E] Multiselection mode (selection box being defined)
+    Rectangle multiSelectRec = { 0 };       // Multiselection box, screen space
+    Vector2 multiSelectStartPos = { 0 };    // Multiselection box starting point
+    GuiLayoutSelection selection = { 0 };   // Controls selected on layout (selectedControl is always included)
 
     // Define colors to be aligned with style selected
     // Colors used for the different modes, states and elements actions
@@ -422,6 +666,8 @@ int main(int argc, char *argv[])
     Color colTracemapSelected = GetColor(GuiGetStyle(BUTTON, BORDER_COLOR_PRESSED));      // Tracemap selected (base + lines)
     Color colTracemapLocked = GetColor(GuiGetStyle(BUTTON, BORDER_COLOR_DISABLED));       // Tracemap locked (border lines)
     Color colTracemapResize = BLUE;             // Tracemap resize mode (keyboard, RCTRL + ARROWS)
+
+    Color colSmartGuides = MAGENTA;             // Smart guides lines
     //-------------------------------------------------------------------------------------------------
 
     // Init default layout
@@ -433,9 +679,11 @@ int main(int argc, char *argv[])
         // NOTE: Anchors and control screen offset is already considered by refWindow (anchor[0])
         layout = LoadLayout(inFileName);
 
-        SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
+        if (layout != NULL) SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
+        else inFileName[0] = '\0';
     }
-    else layout = LoadLayout(NULL);     // Load empty layout
+
+    if (layout == NULL) layout = LoadLayout(NULL);     // Load empty layout
 
     // Previous text/name, required when cancel editing
     char prevText[MAX_CONTROL_TEXT_LENGTH] = { 0 };
@@ -443,8 +691,13 @@ int main(int argc, char *argv[])
     char prevValues[MAX_CONTROL_VALUES_LENGTH] = { 0 };
     //-------------------------------------------------------------------------
 
+#if defined(SUPPORT_STARTUP_TIMING)
+    startupTimeLayout = GetTime();
+#endif
+
     // Undo/redo system variables
     //-------------------------------------------------------------------------
+    // NOTE: Zeroed allocation is not touched until used, undo levels memory is committed as snapshots are pushed
     GuiLayout *undoLayouts = (GuiLayout *)RL_CALLOC(MAX_UNDO_LEVELS, sizeof(GuiLayout));   // Layouts array
     int currentUndoIndex = 0;
     int firstUndoIndex = 0;
@@ -452,7 +705,7 @@ int main(int argc, char *argv[])
     int undoFrameCounter = 0;
 
     // Init undo/redo system with current layout
-    for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
+    ResetUndoLayouts(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
     //-------------------------------------------------------------------------
 
     // Tracemap (background image for reference) variables
@@ -508,18 +761,22 @@ int main(int argc, char *argv[])
     //-----------------------------------------------------------------------------------
 
     // GUI: Help panel
+    // NOTE: Info windows (help, about, sponsor) are initialized on first use
     //-----------------------------------------------------------------------------------
-    GuiWindowHelpState windowHelpState = InitGuiWindowHelp();
+    GuiWindowHelpState windowHelpState = { 0 };
+    bool windowHelpReady = false;
     //-----------------------------------------------------------------------------------
 
     // GUI: About Window
     //-----------------------------------------------------------------------------------
-    GuiWindowAboutState windowAboutState = InitGuiWindowAbout();
+    GuiWindowAboutState windowAboutState = { 0 };
+    bool windowAboutReady = false;
     //-----------------------------------------------------------------------------------
 
     // GUI: Sponsor Window
     //-----------------------------------------------------------------------------------
-    GuiWindowSponsorState windowSponsorState = InitGuiWindowSponsor();
+    GuiWindowSponsorState windowSponsorState = { 0 };
+    bool windowSponsorReady = false;
     //-----------------------------------------------------------------------------------
 
     // GUI: Controls Selection Palette
@@ -537,6 +794,7 @@ int main(int argc, char *argv[])
     //-----------------------------------------------------------------------------------
 
     // GUI: Layout Code Generation Window
+    // NOTE: Code font is loaded on first use (window shown or code set)
     //-----------------------------------------------------------------------------------
     GuiWindowCodegenState windowCodegenState = InitGuiWindowCodegen();
     //-----------------------------------------------------------------------------------
@@ -562,8 +820,29 @@ int main(int argc, char *argv[])
     bool showLoadTemplateDialog = false;
     //-----------------------------------------------------------------------------------
 
+    // Background grid, drawn with a fragment shader (if supported)
+    BackgroundGrid backgroundGrid = LoadBackgroundGrid();
+
+    // File jobs editor state, files are loaded/saved on worker threads
+    // NOTE: Jobs results are applied to editor state on main thread, by ProcessFileJobs()
+    //-----------------------------------------------------------------------------------
+    EditorState editorState = { 0 };
+    editorState.layout = layout;
+    editorState.undoLayouts = undoLayouts;
+    editorState.currentUndoIndex = &currentUndoIndex;
+    editorState.firstUndoIndex = &firstUndoIndex;
+    editorState.lastUndoIndex = &lastUndoIndex;
+    editorState.selection = &selection;
+    editorState.tracemap = &tracemap;
+    editorState.tracemapLoaded = &mainToolbarState.tracemapLoaded;
+    //-----------------------------------------------------------------------------------
+
     int styleFrameCounter = 0;
 
+#if defined(SUPPORT_STARTUP_TIMING)
+    startupTimeEditor = GetTime();
+#endif
+
     SetTargetFPS(60);       // Set our game desired framerate
     //--------------------------------------------------------------------------------------
 
@@ -575,6 +854,14 @@ int main(int argc, char *argv[])
         //framesCounter++;                // General usage frames counter
         mouse = GetMousePosition();     // Get mouse position each frame
 
+        // Smart guides edges are rebuilt on every new drag/scale operation
+        if (!dragMoveMode && !mouseScaleMode)
+        {
+            smartGuides.ready = false;
+            smartGuides.snappedX = false;
+            smartGuides.snappedY = false;
+        }
+
         // WARNING: ASINCIFY requires this line,
         // it contains the call to emscripten_sleep() for PLATFORM_WEB
         if (WindowShouldClose()) windowExitActive = true;
@@ -584,32 +871,13 @@ int main(int argc, char *argv[])
         //----------------------------------------------------------------------------------
         // Every second check if current layout has changed and record a new undo state
         if (!dragMoveMode && !orderLayerMode && !resizeMode && !refWindowEditMode && !valuesEditMode &&
-            !textEditMode && !showIconPanel && !nameEditMode && !anchorEditMode && !anchorLinkMode && !anchorMoveMode)
+            !textEditMode && !showIconPanel && !nameEditMode && !anchorEditMode && !anchorLinkMode && !anchorMoveMode && !mouseScaleMode)
         {
             undoFrameCounter++;
 
             if (undoFrameCounter >= UNDO_SNAPSHOT_FRAMERATE)
             {
-                if (memcmp(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout)) != 0)
-                {
-                    // Move cursor to next available position to record undo
-                    currentUndoIndex++;
-                    if (currentUndoIndex >= MAX_UNDO_LEVELS) currentUndoIndex = 0;
-                    if (currentUndoIndex == firstUndoIndex) firstUndoIndex++;
-                    if (firstUndoIndex >= MAX_UNDO_LEVELS) firstUndoIndex = 0;
-
-                    memcpy(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout));
-
-                    lastUndoIndex = currentUndoIndex;
-
-                    // Set a '*' mark on loaded file name to notice save requirement
-                    if ((inFileName[0] != '\0') && !saveChangesRequired)
-                    {
-                        SetWindowTitle(TextFormat("%s v%s - %s*", toolName, toolVersion, GetFileName(inFileName)));
-                        saveChangesRequired = true;
-                    }
-                }
-
+                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
                 undoFrameCounter = 0;
             }
         }
@@ -626,6 +894,11 @@ int main(int argc, char *argv[])
                 if (memcmp(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout)) != 0)
                 {
                     memcpy(layout, &undoLayouts[currentUndoIndex], sizeof(GuiLayout));
+                    ClearSelection(&selection);
+
+                    // Keep selected control in sync with selection (if still available)
+                    if (selectedControl >= layout->controlCount) selectedControl = -1;
+                    else if (selectedControl != -1) SelectControl(&selection, selectedControl);
                 }
             }
         }
@@ -645,6 +918,11 @@ int main(int argc, char *argv[])
                     if (memcmp(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout)) != 0)
                     {
                         memcpy(layout, &undoLayouts[currentUndoIndex], sizeof(GuiLayout));
+                        ClearSelection(&selection);
+
+                        // Keep selected control in sync with selection (if still available)
+                        if (selectedControl >= layout->controlCount) selectedControl = -1;
+                        else if (selectedControl != -1) SelectControl(&selection, selectedControl);
                     }
                 }
             }
@@ -658,36 +936,19 @@ int main(int argc, char *argv[])
             FilePathList droppedFiles = LoadDroppedFiles();
 
             // Supports loading .rgl layout files (text or binary) and .png tracemap images
+            // NOTE: Files are loaded on worker threads, editor state is replaced on job completion
             if (IsFileExtension(droppedFiles.paths[0], ".rgl"))
             {
-                GuiLayout *tempLayout = LoadLayout(droppedFiles.paths[0]);
-
-                if (tempLayout != NULL)
-                {
-                    memcpy(layout, tempLayout, sizeof(GuiLayout));
-
-                    // WARNING: When layout is loaded, anchor object references are not set, they must be reset manually
-                    for (int i = 0; i < layout->controlCount; i++) layout->controls[i].ap = &layout->anchors[tempLayout->controls[i].ap->id];
-
-                    strcpy(inFileName, droppedFiles.paths[0]);
-                    SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
-
-                    for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
-                    currentUndoIndex = 0;
-                    firstUndoIndex = 0;
-
-                    UnloadLayout(tempLayout);
-                }
+                SubmitFileJob(droppedFiles.paths[0], ProcessLoadLayoutJob, CompleteLoadLayoutJob, NULL, &editorState);
             }
             else if (IsFileExtension(droppedFiles.paths[0], ".png")) // Tracemap image
             {
-                if (tracemap.texture.id > 0) UnloadTexture(tracemap.texture);
-                tracemap.texture = LoadTexture(droppedFiles.paths[0]);
-                tracemap.rec = (Rectangle){ GetMouseX() - tracemap.texture.width/2, GetMouseY() - tracemap.texture.height/2, tracemap.texture.width, tracemap.texture.height};
-                tracemap.visible = true;
-                tracemap.alpha = 0.7f;
+                // Tracemap centered on mouse position once loaded
+                TracemapJobData *jobData = (TracemapJobData *)RL_CALLOC(1, sizeof(TracemapJobData));
+                jobData->position = GetMousePosition();
+                jobData->pivot = (Vector2){ 0.5f, 0.5f };
 
-                mainToolbarState.tracemapLoaded = true;
+                SubmitFileJob(droppedFiles.paths[0], ProcessLoadTracemapJob, CompleteLoadTracemapJob, jobData, &editorState);
             }
             else if (IsFileExtension(droppedFiles.paths[0], ".rgs")) GuiLoadStyle(droppedFiles.paths[0]);
 
@@ -714,10 +975,8 @@ int main(int argc, char *argv[])
             }
             else
             {
-                GuiLayout outLayout = { 0 };
-                memcpy(&outLayout, layout, sizeof(GuiLayout));
-
-                SaveLayout(&outLayout, inFileName);
+                // NOTE: Layout copy is saved on a worker thread, editing can continue
+                SubmitFileJob(inFileName, ProcessSaveLayoutJob, CompleteSaveJob, CopyLayout(layout), NULL);
 
                 SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
                 saveChangesRequired = false;
@@ -743,9 +1002,10 @@ int main(int argc, char *argv[])
             else if (windowCodegenState.codeTemplateActive == 1) config.template = guiTemplateHeaderOnly;
             else if (windowCodegenState.codeTemplateActive == 2) config.template = windowCodegenState.customTemplate;
 
-            // Clear current codeText and generate new layout code
-            RL_FREE(windowCodegenState.codeText);
-            if (config.template != NULL) windowCodegenState.codeText = GenLayoutCode(config.template, layout, (Vector2){ 0.0f, 0.0f }, config);
+            // Request new layout code generation, current codeText is cleared until it is ready
+            // NOTE: Code is generated on a worker thread from a layout snapshot
+            GuiWindowCodegenSetCode(&windowCodegenState, NULL);
+            GenLayoutCodeAsync(config.template, layout, (Vector2){ 0.0f, 0.0f }, config);
 
             // Store current config as prevConfig
             memcpy(&prevConfig, &config, sizeof(GuiLayoutConfig));
@@ -777,15 +1037,21 @@ int main(int argc, char *argv[])
             // Check if config parameter have changed while codegen window is open to regenerate code
             if (memcmp(&prevConfig, &config, sizeof(GuiLayoutConfig)) != 0)
             {
-                // Clear current codeText and generate new layout code
-                RL_FREE(windowCodegenState.codeText);
-                windowCodegenState.codeText = GenLayoutCode(config.template, layout, (Vector2){ 0.0f, 0.0f }, config);
+                // Request new layout code generation, stale requests are cancelled
+                GenLayoutCodeAsync(config.template, layout, (Vector2){ 0.0f, 0.0f }, config);
 
                 // Store current config as prevConfig
                 memcpy(&prevConfig, &config, sizeof(GuiLayoutConfig));
             }
         }
 
+        // Replace current codeText with generated layout code when ready
+        unsigned char *generatedCode = NULL;
+        if (GetLayoutCodeAsync(&generatedCode, false)) GuiWindowCodegenSetCode(&windowCodegenState, generatedCode);
+
+        // Apply finished file jobs results (loaded layouts, tracemaps, saving errors)
+        ProcessFileJobs();
+
         // Show dialog: load tracemap image
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyDown(KEY_LEFT_SHIFT) && IsKeyPressed(KEY_O)) || mainToolbarState.btnLoadTracemapPressed) showLoadTracemapDialog = true;
 
@@ -848,6 +1114,7 @@ int main(int argc, char *argv[])
                     windowExitActive = !windowExitActive;
                     selectedControl = -1;
                     selectedAnchor = -1;
+                    ClearSelection(&selection);
                 }
 #endif
             }
@@ -858,7 +1125,10 @@ int main(int argc, char *argv[])
         if (!showWindowActive && !textEditMode && !nameEditMode && !valuesEditMode)
         {
             // Toggle Grid mode
-            if (IsKeyPressed(KEY_G)) mainToolbarState.showGridActive = !mainToolbarState.showGridActive;
+            if (IsKeyPressed(KEY_G) && !IsKeyDown(KEY_LEFT_ALT)) mainToolbarState.showGridActive = !mainToolbarState.showGridActive;
+
+            // Toggle smart guides mode
+            if (IsKeyDown(KEY_LEFT_ALT) && IsKeyPressed(KEY_G)) smartGuidesActive = !smartGuidesActive;
 
             // Toggle Snap to grid mode
             if (IsKeyDown(KEY_LEFT_ALT) && IsKeyPressed(KEY_S))
@@ -895,7 +1165,8 @@ int main(int argc, char *argv[])
             if (IsKeyPressed(KEY_H) && tracemap.selected) mainToolbarState.hideTracemapActive = true;
 
             // Toggle anchor mode editing (on key down)
-            anchorEditMode = IsKeyDown(KEY_A);
+            // NOTE: LEFT_CONTROL + A is reserved for controls select-all
+            anchorEditMode = IsKeyDown(KEY_A) && !IsKeyDown(KEY_LEFT_CONTROL);
 
             // Toggle precision move/scale mode
             precisionEditMode = IsKeyDown(KEY_LEFT_SHIFT);
@@ -915,6 +1186,18 @@ int main(int argc, char *argv[])
             {
                 // Open reset window
                 if (IsKeyPressed(KEY_N)) windowResetActive = true;
+
+                // Select all controls (not hidden)
+                if (IsKeyPressed(KEY_A))
+                {
+                    ClearSelection(&selection);
+                    for (int i = 0; i < layout->controlCount; i++)
+                    {
+                        if (!layout->controls[i].ap->hidding) SelectControl(&selection, i);
+                    }
+
+                    if (!IsControlSelected(&selection, selectedControl)) selectedControl = (selection.count > 0)? selection.indices[selection.count - 1] : -1;
+                }
             }
 
             // Grid spacing customization
@@ -943,25 +1226,8 @@ int main(int argc, char *argv[])
         // Visual options logic
         if (mainToolbarState.visualStyleActive != mainToolbarState.prevVisualStyleActive)
         {
-            // Reset to default internal style
-            // NOTE: Required to unload any previously loaded font texture
-            GuiLoadStyleDefault();
-
-            switch (mainToolbarState.visualStyleActive)
-            {
-                case 1: GuiLoadStyleJungle(); break;
-                case 2: GuiLoadStyleCandy(); break;
-                case 3: GuiLoadStyleLavanda(); break;
-                case 4: GuiLoadStyleCyber(); break;
-                case 5: GuiLoadStyleTerminal(); break;
-                case 6: GuiLoadStyleAshes(); break;
-                case 7: GuiLoadStyleBluish(); break;
-                case 8: GuiLoadStyleDark(); break;
-                case 9: GuiLoadStyleCherry(); break;
-                case 10: GuiLoadStyleSunny(); break;
-                case 11: GuiLoadStyleEnefete(); break;
-                default: break;
-            }
+            // Load selected style, from cache if already loaded
+            LoadVisualStyle(mainToolbarState.visualStyleActive);
 
             // Update colors for the style
             // Colors used for the different modes, states and elements actions
@@ -1001,6 +1267,8 @@ int main(int argc, char *argv[])
             colTracemapSelected = GetColor(GuiGetStyle(BUTTON, BORDER_COLOR_PRESSED));      // Tracemap selected (base + lines)
             colTracemapLocked = GetColor(GuiGetStyle(BUTTON, BORDER_COLOR_DISABLED));       // Tracemap locked (border lines)
             colTracemapResize = BLUE;             // Tracemap resize mode (keyboard, RCTRL + ARROWS)
+
+            colSmartGuides = MAGENTA;             // Smart guides lines
             //-------------------------------------------------------------------------------------------------
 
             mainToolbarState.prevVisualStyleActive = mainToolbarState.visualStyleActive;
@@ -1010,6 +1278,28 @@ int main(int argc, char *argv[])
         if (mainToolbarState.btnHelpPressed) windowHelpState.windowActive = true;           // Help button logic
         if (mainToolbarState.btnAboutPressed) windowAboutState.windowActive = true;         // About window button logic
         if (mainToolbarState.btnSponsorPressed) windowSponsorState.windowActive = true;     // User sponsor logic
+
+        // Info windows initialization on first use
+        if (windowHelpState.windowActive && !windowHelpReady)
+        {
+            windowHelpState = InitGuiWindowHelp();
+            windowHelpState.windowActive = true;
+            windowHelpReady = true;
+        }
+
+        if (windowAboutState.windowActive && !windowAboutReady)
+        {
+            windowAboutState = InitGuiWindowAbout();
+            windowAboutState.windowActive = true;
+            windowAboutReady = true;
+        }
+
+        if (windowSponsorState.windowActive && !windowSponsorReady)
+        {
+            windowSponsorState = InitGuiWindowSponsor();
+            windowSponsorState.windowActive = true;
+            windowSponsorReady = true;
+        }
         //----------------------------------------------------------------------------------
 
         // Layout edition logic
@@ -1262,6 +1552,7 @@ int main(int argc, char *argv[])
                             layout->controls[focusedControl].id -= 1;
                             layout->controls[focusedControl + 1] = auxControl;
                             layout->controls[focusedControl + 1].id += 1;
+                            SwapSelectionSlots(&selection, focusedControl, focusedControl + 1);
                             selectedControl = -1;
                         }
                         else if ((newOrder < 0) && (focusedControl > 0))
@@ -1272,6 +1563,7 @@ int main(int argc, char *argv[])
                             layout->controls[focusedControl].id += 1;
                             layout->controls[focusedControl - 1] = auxControl;
                             layout->controls[focusedControl - 1].id -= 1;
+                            SwapSelectionSlots(&selection, focusedControl, focusedControl - 1);
                             selectedControl = -1;
                         }
                     }
@@ -1283,6 +1575,23 @@ int main(int argc, char *argv[])
                 {
                     selectedControl = focusedControl;
                     if ((focusedAnchor != -1) || anchorLinkMode || anchorEditMode) selectedControl = -1;
+
+                    // Update controls selection
+                    // NOTE: LEFT_CONTROL/LEFT_SHIFT + click toggles control selection,
+                    // clicking an already selected control keeps current selection (group edition)
+                    if ((selectedControl != -1) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON) &&
+                        (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_LEFT_SHIFT)))
+                    {
+                        ToggleControlSelection(&selection, selectedControl);
+
+                        // Unselected control is replaced by last selected one (if any)
+                        if (!IsControlSelected(&selection, selectedControl)) selectedControl = (selection.count > 0)? selection.indices[selection.count - 1] : -1;
+                    }
+                    else if ((selectedControl == -1) || !IsControlSelected(&selection, selectedControl))
+                    {
+                        ClearSelection(&selection);
+                        if (selectedControl != -1) SelectControl(&selection, selectedControl);
+                    }
                 }
 
                 // On selected control
@@ -1305,7 +1614,12 @@ int main(int argc, char *argv[])
                                                                    SCALE_BOX_CORNER_SIZE, SCALE_BOX_CORNER_SIZE }))
                     {
                         mouseScaleReady = true;
-                        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) mouseScaleMode = true;
+                        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                        {
+                            // Record layout before scaling, the whole resize is one undo step
+                            PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                            mouseScaleMode = true;
+                        }
                     }
                     else mouseScaleReady = false;
 
@@ -1319,6 +1633,17 @@ int main(int argc, char *argv[])
                         if (rec.width < SCALE_BOX_CORNER_SIZE) rec.width = SCALE_BOX_CORNER_SIZE;
                         if (rec.height < SCALE_BOX_CORNER_SIZE) rec.height = SCALE_BOX_CORNER_SIZE;
 
+                        // Snap right/bottom edges to smart guides
+                        if (smartGuidesActive)
+                        {
+                            if (!smartGuides.ready) BuildSmartGuides(&smartGuides, layout, &selection);
+
+                            Vector2 snapOffset = GetSmartGuidesSnap(&smartGuides, rec, true);
+
+                            if ((rec.width + snapOffset.x) >= SCALE_BOX_CORNER_SIZE) rec.width += snapOffset.x;
+                            if ((rec.height + snapOffset.y) >= SCALE_BOX_CORNER_SIZE) rec.height += snapOffset.y;
+                        }
+
                         // NOTE: We must consider anchor offset!
                         if (layout->controls[selectedControl].ap->id > 0)
                         {
@@ -1328,7 +1653,11 @@ int main(int argc, char *argv[])
 
                         layout->controls[selectedControl].rec = rec;
 
-                        if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) mouseScaleMode = false;
+                        if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+                        {
+                            PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                            mouseScaleMode = false;
+                        }
                     }
                     //--------------------------------------------------------------------------
 
@@ -1352,16 +1681,42 @@ int main(int argc, char *argv[])
                                 else controlPosY -= offsetY;
                             }
 
+                            // Snap to smart guides (edges and centers of other controls, anchors)
+                            // NOTE: Smart guides snapping overrides grid snapping when in snap distance
+                            if (smartGuidesActive)
+                            {
+                                if (!smartGuides.ready) BuildSmartGuides(&smartGuides, layout, &selection);
+
+                                Rectangle rec = layout->controls[selectedControl].rec;
+                                rec.x = controlPosX;
+                                rec.y = controlPosY;
+
+                                // NOTE: Control position is relative to anchor, unless global position is shown
+                                if ((layout->controls[selectedControl].ap->id > 0) && !showGlobalPosition)
+                                {
+                                    rec.x += layout->controls[selectedControl].ap->x;
+                                    rec.y += layout->controls[selectedControl].ap->y;
+                                }
+
+                                Vector2 snapOffset = GetSmartGuidesSnap(&smartGuides, rec, false);
+                                controlPosX += (int)roundf(snapOffset.x);
+                                controlPosY += (int)roundf(snapOffset.y);
+                            }
+
                             if (showGlobalPosition && (layout->controls[selectedControl].ap->id != 0))
                             {
                                 controlPosX -= layout->controls[selectedControl].ap->x;
                                 controlPosY -= layout->controls[selectedControl].ap->y;
                             }
 
-                            layout->controls[selectedControl].rec.x = controlPosX;
-                            layout->controls[selectedControl].rec.y = controlPosY;
+                            // Move all selected controls (selectedControl included) by the same offset
+                            MoveSelectedControls(layout, &selection, controlPosX - layout->controls[selectedControl].rec.x, controlPosY - layout->controls[selectedControl].rec.y);
 
-                            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) dragMoveMode = false;
+                            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+                            {
+                                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                dragMoveMode = false;
+                            }
                         }
                         else
                         {
@@ -1370,21 +1725,19 @@ int main(int argc, char *argv[])
                                 // Duplicate control
                                 if (IsKeyPressed(KEY_D))
                                 {
-                                    layout->controls[layout->controlCount].id = layout->controlCount;
-                                    layout->controls[layout->controlCount].type = layout->controls[selectedControl].type;
-                                    layout->controls[layout->controlCount].rec = layout->controls[selectedControl].rec;
-                                    layout->controls[layout->controlCount].rec.x += 10;
-                                    layout->controls[layout->controlCount].rec.y += 10;
-                                    strcpy(layout->controls[layout->controlCount].text, layout->controls[selectedControl].text);
-                                    strcpy(layout->controls[layout->controlCount].name, TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount));
-									strcpy(layout->controls[layout->controlCount].values, layout->controls[selectedControl].values);
-                                    layout->controls[layout->controlCount].ap = layout->controls[selectedControl].ap;            // Default anchor point (0, 0)
-
-                                    layout->controlCount++;
-
-                                    selectedControl = layout->controlCount - 1;
+                                    // NOTE: Reference control duplicate keeps same position in selection
+                                    int position = selection.position[selectedControl];
+
+                                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                    if (DuplicateSelectedControls(layout, &selection))
+                                    {
+                                        selectedControl = selection.indices[position];
+                                        PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                    }
                                 }
 
+                                Rectangle prevRec = layout->controls[selectedControl].rec;
+
                                 // Resize control
                                 int offsetX = (int)layout->controls[selectedControl].rec.width%gridSnapDelta;
                                 int offsetY = (int)layout->controls[selectedControl].rec.height%gridSnapDelta;
@@ -1434,6 +1787,15 @@ int main(int argc, char *argv[])
                                 // Minimum size limit
                                 if (layout->controls[selectedControl].rec.width < MIN_CONTROL_SIZE) layout->controls[selectedControl].rec.width = MIN_CONTROL_SIZE;
                                 if (layout->controls[selectedControl].rec.height < MIN_CONTROL_SIZE) layout->controls[selectedControl].rec.height = MIN_CONTROL_SIZE;
+
+                                // Resize all selected controls by reference control size change
+                                if (selection.count > 1)
+                                {
+                                    Rectangle newRec = layout->controls[selectedControl].rec;
+                                    layout->controls[selectedControl].rec = prevRec;
+
+                                    ResizeSelectedControls(layout, &selection, newRec.width - prevRec.width, newRec.height - prevRec.height);
+                                }
                             }
                             else
                             {
@@ -1498,17 +1860,38 @@ int main(int argc, char *argv[])
                                     controlPosY -= layout->controls[selectedControl].ap->y;
                                 }
 
-                                layout->controls[selectedControl].rec.x = controlPosX;
-                                layout->controls[selectedControl].rec.y = controlPosY;
+                                // NOTE: LEFT_ALT + ARROWS are reserved for selected controls alignment
+                                if (!IsKeyDown(KEY_LEFT_ALT))
+                                {
+                                    MoveSelectedControls(layout, &selection, controlPosX - layout->controls[selectedControl].rec.x, controlPosY - layout->controls[selectedControl].rec.y);
+                                }
+                                else if (selection.count > 1)
+                                {
+                                    // Align/distribute selected controls
+                                    int alignment = -1;
+                                    if (IsKeyPressed(KEY_LEFT)) alignment = CONTROLS_ALIGN_LEFT;
+                                    else if (IsKeyPressed(KEY_RIGHT)) alignment = CONTROLS_ALIGN_RIGHT;
+                                    else if (IsKeyPressed(KEY_UP)) alignment = CONTROLS_ALIGN_TOP;
+                                    else if (IsKeyPressed(KEY_DOWN)) alignment = CONTROLS_ALIGN_BOTTOM;
+
+                                    if ((alignment != -1) || IsKeyPressed(KEY_H) || IsKeyPressed(KEY_V))
+                                    {
+                                        PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+
+                                        if (alignment != -1) AlignSelectedControls(layout, &selection, alignment);
+                                        else DistributeSelectedControls(layout, &selection, IsKeyPressed(KEY_V));
+
+                                        PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                    }
+                                }
                                 //---------------------------------------------------------------------
 
                                 // Unlinks the control selected from its current anchor
-                                if ((layout->controls[selectedControl].ap->id != 0) && IsKeyPressed(KEY_U))
+                                if (IsKeyPressed(KEY_U))
                                 {
-
-                                    layout->controls[selectedControl].rec.x += layout->controls[selectedControl].ap->x;
-                                    layout->controls[selectedControl].rec.y += layout->controls[selectedControl].ap->y;
-                                    layout->controls[selectedControl].ap = &layout->anchors[0];
+                                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                    LinkSelectedControls(layout, &selection, &layout->anchors[0]);
+                                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
                                 }
 
                                 // Delete selected control
@@ -1516,18 +1899,10 @@ int main(int argc, char *argv[])
                                 {
                                     mouseScaleReady = false;
 
-                                    for (int i = selectedControl; i < layout->controlCount; i++)
-                                    {
-                                        layout->controls[i].type = layout->controls[i + 1].type;
-                                        layout->controls[i].rec = layout->controls[i + 1].rec;
-                                        memset(layout->controls[i].text, 0, MAX_CONTROL_TEXT_LENGTH);
-                                        memset(layout->controls[i].name, 0, MAX_CONTROL_NAME_LENGTH);
-                                        strcpy(layout->controls[i].text, layout->controls[i + 1].text);
-                                        strcpy(layout->controls[i].name, layout->controls[i + 1].name);
-                                        layout->controls[i].ap = layout->controls[i + 1].ap;
-                                    }
+                                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                    DeleteSelectedControls(layout, &selection);
+                                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
 
-                                    layout->controlCount--;
                                     focusedControl = -1;
                                     selectedControl = -1;
                                 }
@@ -1544,6 +1919,8 @@ int main(int argc, char *argv[])
                                     }
                                     else prevPosition = (Vector2){ layout->controls[selectedControl].rec.x, layout->controls[selectedControl].rec.y };
 
+                                    // Record layout before moving, the whole drag is one undo step
+                                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
                                     dragMoveMode = true;
                                 }
                                 else if (IsMouseButtonDown(MOUSE_RIGHT_BUTTON))
@@ -1562,7 +1939,7 @@ int main(int argc, char *argv[])
                                     textBoxCursorIndex = (int)strlen(layout->controls[selectedControl].name);
                                     nameEditMode = true;
                                 }
-                                else if (IsKeyReleased(KEY_V))
+                                else if (IsKeyReleased(KEY_V) && !IsKeyDown(KEY_LEFT_ALT))
                                 {
                                     strcpy(prevValues, layout->controls[selectedControl].values);
                                     textBoxCursorIndex = (int)strlen(layout->controls[selectedControl].values);
@@ -1577,16 +1954,12 @@ int main(int argc, char *argv[])
                         {
                             anchorLinkMode = false;
 
-                            if (layout->controls[selectedControl].ap->id > 0)
+                            // Link all selected controls to focused anchor
+                            if (focusedAnchor != -1)
                             {
-                                layout->controls[selectedControl].rec.x += layout->controls[selectedControl].ap->x;
-                                layout->controls[selectedControl].rec.y += layout->controls[selectedControl].ap->y;
-                            }
-                            layout->controls[selectedControl].ap = &layout->anchors[focusedAnchor];
-                            if (focusedAnchor > 0)
-                            {
-                                layout->controls[selectedControl].rec.x -= layout->anchors[focusedAnchor].x;
-                                layout->controls[selectedControl].rec.y -= layout->anchors[focusedAnchor].y;
+                                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                LinkSelectedControls(layout, &selection, &layout->anchors[focusedAnchor]);
+                                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
                             }
                         }
                     }
@@ -1594,112 +1967,49 @@ int main(int argc, char *argv[])
             }
             //----------------------------------------------------------------------------------------------
 
-            // TODO: Controls multi-selection and edition logic
+            // Controls multi-selection logic
             //----------------------------------------------------------------------------------------------
-            /*
-            if ((selectedControl == -1) && IsMouseButtonPressed(MOUSE_RIGHT_BUTTON))
+            // Start selection box on mouse right button pressed over empty work area
+            if (!multiSelectMode && (selectedControl == -1) && (focusedControl == -1) && (focusedAnchor == -1) &&
+                !anchorEditMode && !anchorLinkMode && !anchorMoveMode && !tracemap.focused &&
+                IsMouseButtonPressed(MOUSE_RIGHT_BUTTON) &&
+                CheckCollisionPointRec(mouse, (Rectangle){ 0, 40, GetScreenWidth(), GetScreenHeight() - 64 }) &&
+                !CheckCollisionPointRec(mouse, windowControlsPaletteState.panelBounds))
             {
                 multiSelectMode = true;
                 multiSelectStartPos = mouse;
+                multiSelectRec = (Rectangle){ mouse.x, mouse.y, 0, 0 };
 
-                multiSelectRec.x = multiSelectStartPos.x;
-                multiSelectRec.y = multiSelectStartPos.y;
+                // NOTE: Selection is extended if LEFT_CONTROL/LEFT_SHIFT modifiers are down
+                if (!IsKeyDown(KEY_LEFT_CONTROL) && !IsKeyDown(KEY_LEFT_SHIFT)) ClearSelection(&selection);
             }
 
             if (multiSelectMode)
             {
-                multiSelectRec.width = mouse.x - multiSelectStartPos.x;
-                multiSelectRec.height = mouse.y - multiSelectStartPos.y;
-
-                if (multiSelectRec.width < 0)
-                {
-                    multiSelectRec.x = mouse.x;
-                    multiSelectRec.width *= -1;
-                }
-
-                if (multiSelectRec.height < 0)
-                {
-                    multiSelectRec.y = mouse.y;
-                    multiSelectRec.height *= -1;
-                }
+                multiSelectRec.x = (mouse.x < multiSelectStartPos.x)? mouse.x : multiSelectStartPos.x;
+                multiSelectRec.y = (mouse.y < multiSelectStartPos.y)? mouse.y : multiSelectStartPos.y;
+                multiSelectRec.width = (mouse.x < multiSelectStartPos.x)? (multiSelectStartPos.x - mouse.x) : (mouse.x - multiSelectStartPos.x);
+                multiSelectRec.height = (mouse.y < multiSelectStartPos.y)? (multiSelectStartPos.y - mouse.y) : (mouse.y - multiSelectStartPos.y);
 
                 if (IsMouseButtonReleased(MOUSE_RIGHT_BUTTON))
                 {
-                    // Check all the controls inside the selection rectangle
+                    // Check all the controls fully contained in the selection rectangle
+                    // NOTE: multiSelectRec is in screen-space, controls rectangles must consider anchor offset
                     for (int i = 0; i < layout->controlCount; i++)
                     {
-                        // TODO: Check if full control rec is contained in multiSelectRec
-                        // WARNING: multiSelectRec is in screen-space, we must consider rec, anchor and refWindow!
-                        if (CheckCollisionRecs(multiSelectRec, layout->controls[i].rec))
-                        {
-                            multiSelectControls[multiSelectCount] = i;
-                            multiSelectCount++;
-                        }
-                    }
-
-                    if (multiSelectCount == 0) multiSelectMode = false;
-                    else
-                    {
-                        // Calculate multi-selection rectangle
-                        multiSelectRec = (Rectangle){ 16384, 16384, 0, 0 };
-                        Vector2 maxValue = { 0 };
-
-                        for (int i = 0; i < multiSelectCount; i++)
+                        if (!layout->controls[i].ap->hidding && IsRecContainedInRec(multiSelectRec, GetControlScreenRec(&layout->controls[i])))
                         {
-                            // Get minimum value
-                            if (layout->controls[multiSelectControls[i]].rec.x < multiSelectRec.x) multiSelectRec.x = layout->controls[multiSelectControls[i]].rec.x;
-                            if (layout->controls[multiSelectControls[i]].rec.y < multiSelectRec.y) multiSelectRec.y = layout->controls[multiSelectControls[i]].rec.y;
-
-                            // Get maximum value
-                            if ((layout->controls[multiSelectControls[i]].rec.x + layout->controls[multiSelectControls[i]].rec.width) > maxValue.x) maxValue.x = layout->controls[multiSelectControls[i]].rec.x + layout->controls[multiSelectControls[i]].rec.width;
-                            if ((layout->controls[multiSelectControls[i]].rec.y + layout->controls[multiSelectControls[i]].rec.height) > maxValue.y) maxValue.y = layout->controls[multiSelectControls[i]].rec.y + layout->controls[multiSelectControls[i]].rec.height;
-                            multiSelectRec.width = maxValue.x - multiSelectRec.x;
-                            multiSelectRec.height = maxValue.y - multiSelectRec.y;
+                            if (IsKeyDown(KEY_LEFT_CONTROL)) ToggleControlSelection(&selection, i);
+                            else SelectControl(&selection, i);
                         }
-
-                        multiSelectMode = false;
-                    }
-                }
-            }
-
-            // Reset multi selection
-            if ((multiSelectCount > 0) && IsMouseButtonPressed(MOUSE_RIGHT_BUTTON))
-            {
-                for (int i = 0; i < 20; i++) multiSelectControls[i] = -1;
-                multiSelectCount = 0;
-            }
-
-            // Multi selection delete logic
-            if ((multiSelectCount > 0) && IsKeyPressed(KEY_DELETE))
-            {
-                for (int j = 0; j < multiSelectCount; j++)
-                {
-                    for (int i = multiSelectControls[j]; i < layout->controlCount; i++)
-                    {
-                        layout->controls[i].type = layout->controls[i + 1].type;
-                        layout->controls[i].rec = layout->controls[i + 1].rec;
-                        memset(layout->controls[i].text, 0, MAX_CONTROL_TEXT_LENGTH);
-                        memset(layout->controls[i].name, 0, MAX_CONTROL_NAME_LENGTH);
-                        strcpy(layout->controls[i].text, layout->controls[i + 1].text);
-                        strcpy(layout->controls[i].name, layout->controls[i + 1].name);
-                        layout->controls[i].ap = layout->controls[i + 1].ap;
                     }
 
-                    layout->controlCount--;
+                    // Last selected control is used as reference control for bulk edition
+                    if (selection.count > 0) selectedControl = selection.indices[selection.count - 1];
 
-                    // As we moved all controls one position, we need to update selected
-                    // controls position for next control deletion
-                    for (int i = 0; i < multiSelectCount; i++) multiSelectControls[i] -= 1;
+                    multiSelectMode = false;
                 }
-
-                // Reset multi selection
-                for (int i = 0; i < 20; i++) multiSelectControls[i] = -1;
-                multiSelectCount = 0;
-
-                focusedControl = -1;
-                selectedControl = -1;
             }
-            */
             //----------------------------------------------------------------------------------------------
 
             // Anchors selection and edition logic
@@ -1851,6 +2161,7 @@ int main(int argc, char *argv[])
                                     anchorMoveMode = false;
                                 }
 
+                                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
                                 dragMoveMode = false;
                             }
                         }
@@ -1930,7 +2241,12 @@ int main(int argc, char *argv[])
                                 if (selectedAnchor == 0) layout->refWindow = (Rectangle){ layout->anchors[0].x, layout->anchors[0].y, layout->refWindow.width, layout->refWindow.height };
 
                                 // Activate anchor position edit mode
-                                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) dragMoveMode = true;
+                                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                                {
+                                    // Record layout before moving, the whole drag is one undo step
+                                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                                    dragMoveMode = true;
+                                }
                                 else if (IsMouseButtonDown(MOUSE_RIGHT_BUTTON))
                                 {
                                     if (selectedAnchor == 0) refWindowEditMode = true;  // Activate ref window edit
@@ -2162,8 +2478,7 @@ int main(int argc, char *argv[])
                             // Delete tracemap
                             if (IsKeyPressed(KEY_DELETE))
                             {
-                                UnloadTexture(tracemap.texture);
-                                tracemap.texture.id = 0;
+                                UnloadTracemap(&tracemap);
                                 tracemap.rec.x = 0;
                                 tracemap.rec.y = 0;
 
@@ -2203,6 +2518,7 @@ int main(int argc, char *argv[])
             selectedAnchor = -1;
             focusedControl = -1;
             selectedControl = -1;
+            ClearSelection(&selection);
 
             resizeMode = false;
             dragMoveMode = false;
@@ -2217,9 +2533,7 @@ int main(int argc, char *argv[])
             strcpy(inFileName, "\0");
             SetWindowTitle(TextFormat("%s v%s", toolName, toolVersion));
 
-            for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
-            currentUndoIndex = 0;
-            firstUndoIndex = 0;
+            ResetUndoLayouts(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
 
             resetLayout = false;
         }
@@ -2262,18 +2576,17 @@ int main(int argc, char *argv[])
             ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
 
             // Draw background grid
-            Vector2 mouseCell = { 0 };
             if (mainToolbarState.showGridActive)
             {
                 // Draw grid covering the screen work area
-                GuiGrid((Rectangle){ 0, 40, GetScreenWidth(), GetScreenHeight() - 64 }, NULL, gridSpacing*gridSubdivisions, gridSubdivisions, &mouseCell);
+                DrawBackgroundGrid(&backgroundGrid, (Rectangle){ 0, 40, GetScreenWidth(), GetScreenHeight() - 64 }, gridSpacing, gridSubdivisions);
             }
 
             // Draw tracemap
             //---------------------------------------------------------------------------------
-            if (tracemap.visible && (tracemap.texture.id > 0))
+            if (tracemap.visible && tracemap.loaded)
             {
-                DrawTexturePro(tracemap.texture, (Rectangle){ 0, 0, tracemap.texture.width, tracemap.texture.height }, tracemap.rec, (Vector2){ 0, 0 }, 0.0f, Fade(WHITE, tracemap.alpha));
+                DrawTracemap(&tracemap, Fade(WHITE, tracemap.alpha));
 
                 if (tracemap.locked)
                 {
@@ -2582,9 +2895,22 @@ int main(int argc, char *argv[])
                 // Draw multiselection rectangle
                 if (multiSelectMode)
                 {
+                    DrawRectangleRec(multiSelectRec, Fade(colAnchorDefault, 0.1f));
                     DrawRectangleLinesEx(multiSelectRec, 2.0f, colAnchorDefault);
                 }
 
+                // Draw multi-selected controls
+                // NOTE: selectedControl is drawn below with its edition info
+                for (int i = 0; i < selection.count; i++)
+                {
+                    if (selection.indices[i] == selectedControl) continue;
+
+                    Rectangle rec = GetControlScreenRec(&layout->controls[selection.indices[i]]);
+
+                    DrawRectangleRec(rec, Fade(colControlSelected, 0.2f));
+                    DrawRectangleLinesEx(rec, 1.0f, colControlSelected);
+                }
+
                 // Draw anchor edit data
                 // NOTE: Only if GUI is not locked!
                 if (selectedAnchor != -1)
@@ -2612,6 +2938,10 @@ int main(int argc, char *argv[])
                     }
                 }
 
+                // Draw smart guides (control being dragged or scaled snapped)
+                if (smartGuides.snappedX) DrawRectangleRec((Rectangle){ smartGuides.guideX.position, smartGuides.guideX.min, 1, smartGuides.guideX.max - smartGuides.guideX.min }, colSmartGuides);
+                if (smartGuides.snappedY) DrawRectangleRec((Rectangle){ smartGuides.guideY.min, smartGuides.guideY.position, smartGuides.guideY.max - smartGuides.guideY.min, 1 }, colSmartGuides);
+
                 // Draw selected control
                 if (selectedControl != -1)
                 {
@@ -3005,30 +3335,23 @@ int main(int argc, char *argv[])
             // Control: Duplicate selected control if required
             if (mainToolbarState.btnDuplicateControlPressed)
             {
-                layout->controls[layout->controlCount].id = layout->controlCount;
-                layout->controls[layout->controlCount].type = layout->controls[selectedControl].type;
-                layout->controls[layout->controlCount].rec = layout->controls[selectedControl].rec;
-                layout->controls[layout->controlCount].rec.x += 10;
-                layout->controls[layout->controlCount].rec.y += 10;
-                strcpy(layout->controls[layout->controlCount].text, layout->controls[selectedControl].text);
-                strcpy(layout->controls[layout->controlCount].name, TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount));
-                layout->controls[layout->controlCount].ap = layout->controls[selectedControl].ap;            // Default anchor point (0, 0)
+                int position = selection.position[selectedControl];
 
-                layout->controlCount++;
-
-                selectedControl = layout->controlCount - 1;
+                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                if (DuplicateSelectedControls(layout, &selection))
+                {
+                    selectedControl = selection.indices[position];
+                    PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                }
             }
 
             // Control: Unlink from anchor
             if (mainToolbarState.btnUnlinkControlPressed)
             {
-                if (layout->controls[selectedControl].ap->id != 0)
-                {
-
-                    layout->controls[selectedControl].rec.x += layout->controls[selectedControl].ap->x;
-                    layout->controls[selectedControl].rec.y += layout->controls[selectedControl].ap->y;
-                    layout->controls[selectedControl].ap = &layout->anchors[0];  // Link to default work area anchor
-                }
+                // Link to default work area anchor
+                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                LinkSelectedControls(layout, &selection, &layout->anchors[0]);
+                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
             }
 
             // Control: Delete if required
@@ -3036,18 +3359,10 @@ int main(int argc, char *argv[])
             {
                 mouseScaleReady = false;
 
-                for (int i = selectedControl; i < layout->controlCount; i++)
-                {
-                    layout->controls[i].type = layout->controls[i + 1].type;
-                    layout->controls[i].rec = layout->controls[i + 1].rec;
-                    memset(layout->controls[i].text, 0, MAX_CONTROL_TEXT_LENGTH);
-                    memset(layout->controls[i].name, 0, MAX_CONTROL_NAME_LENGTH);
-                    strcpy(layout->controls[i].text, layout->controls[i + 1].text);
-                    strcpy(layout->controls[i].name, layout->controls[i + 1].name);
-                    layout->controls[i].ap = layout->controls[i + 1].ap;
-                }
+                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
+                DeleteSelectedControls(layout, &selection);
+                PushUndoLayout(undoLayouts, &currentUndoIndex, &firstUndoIndex, &lastUndoIndex, layout);
 
-                layout->controlCount--;
                 focusedControl = -1;
                 selectedControl = -1;
             }
@@ -3121,8 +3436,7 @@ int main(int argc, char *argv[])
             // Tracemap: Delete current tracemap
             if (mainToolbarState.btnDeleteTracemapPressed)
             {
-                UnloadTexture(tracemap.texture);
-                tracemap.texture.id = 0;
+                UnloadTracemap(&tracemap);
                 tracemap.rec.x = 0;
                 tracemap.rec.y = 0;
 
@@ -3249,6 +3563,10 @@ int main(int argc, char *argv[])
 
             if (windowCodegenState.btnExportCodePressed)
             {
+                // Make sure latest requested code is the one exported
+                unsigned char *generatedCode = NULL;
+                if (GetLayoutCodeAsync(&generatedCode, true)) GuiWindowCodegenSetCode(&windowCodegenState, generatedCode);
+
                 if (windowCodegenState.codeTemplateActive == 1) strcpy(outFileName, TextFormat("gui_%s.h", config.name));
                 else strcpy(outFileName, TextFormat("%s.c", config.name));
 
@@ -3308,27 +3626,8 @@ int main(int argc, char *argv[])
 #endif
                 if (result == 1)
                 {
-                    // Load layout file
-                    GuiLayout *tempLayout = LoadLayout(inFileName);
-
-                    if (tempLayout != NULL)
-                    {
-                        memcpy(layout, tempLayout, sizeof(GuiLayout));
-
-                        // WARNING: When layout is loaded, anchor object references are not set, they must be reset manually
-                        for (int i = 0; i < layout->controlCount; i++) layout->controls[i].ap = &layout->anchors[tempLayout->controls[i].ap->id];
-
-                        // Reinit undo levels for new layout
-                        for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
-                        currentUndoIndex = 0;
-                        firstUndoIndex = 0;
-
-                        UnloadLayout(tempLayout);
-
-                        SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
-                        saveChangesRequired = false;
-                    }
-                    else inFileName[0] = '\0';
+                    // Load layout file on a worker thread, layout is replaced on job completion
+                    SubmitFileJob(inFileName, ProcessLoadLayoutJob, CompleteLoadLayoutJob, NULL, &editorState);
                 }
 
                 if (result >= 0) showLoadFileDialog = false;
@@ -3352,21 +3651,12 @@ int main(int argc, char *argv[])
                     if (!IsFileNameValid(GetFileName(outFileName))) strcpy(outFileName, "layout.rgl");
                     if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgl")) strcat(outFileName, ".rgl\0");
 
-                    GuiLayout outLayout = { 0 };
-                    memcpy(&outLayout, layout, sizeof(GuiLayout));
-
-                    SaveLayout(&outLayout, outFileName);
+                    // NOTE: Layout copy is saved on a worker thread, web download is done on job completion
+                    SubmitFileJob(outFileName, ProcessSaveLayoutJob, CompleteSaveJob, CopyLayout(layout), NULL);
 
                     strcpy(inFileName, outFileName);
                     SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
                     saveChangesRequired = false;
-
-                #if defined(PLATFORM_WEB)
-                    // Download file from MEMFS (emscripten memory filesystem)
-                    // NOTE: Second argument must be a simple filename (we can't use directories)
-                    // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
-                    if (strchr(outFileName, '\'') == NULL) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
-                #endif
                 }
 
                 if (result >= 0) showSaveFileDialog = false;
@@ -3392,17 +3682,15 @@ int main(int argc, char *argv[])
                     if ((GetFileExtension(outFileName) == NULL) ||
                         (!IsFileExtension(outFileName, ".c") && !IsFileExtension(outFileName, ".h"))) strcat(outFileName, ".h\0");
 
-                    // Write code string to file
-                    FILE *ftool = fopen(outFileName, "wt");
-                    fprintf(ftool, windowCodegenState.codeText);
-                    fclose(ftool);
-
-                #if defined(PLATFORM_WEB)
-                    // Download file from MEMFS (emscripten memory filesystem)
-                    // NOTE: Second argument must be a simple filename (we can't use directories)
-                    // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
-                    if (strchr(outFileName, '\'') == NULL) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
-                #endif
+                    // Write code string copy to file on a worker thread
+                    if (windowCodegenState.codeText != NULL)
+                    {
+                        int codeLength = (int)strlen(windowCodegenState.codeText);
+                        unsigned char *code = (unsigned char *)RL_MALLOC(codeLength + 1);
+                        memcpy(code, windowCodegenState.codeText, codeLength + 1);
+
+                        SubmitFileJob(outFileName, ProcessSaveTextJob, CompleteSaveJob, code, NULL);
+                    }
                 }
 
                 if (result >= 0) showExportFileDialog = false;
@@ -3420,20 +3708,11 @@ int main(int argc, char *argv[])
 #endif
                 if (result == 1)
                 {
-                    // Load layout file
-                    Texture2D texture = LoadTexture(inFileName);
-
-                    if (texture.id > 0)
-                    {
-                        if (tracemap.texture.id > 0) UnloadTexture(tracemap.texture);
-                        tracemap.texture = texture;
-                        tracemap.rec = (Rectangle){ 48 + layout->refWindow.x, 48 + layout->refWindow.y, tracemap.texture.width, tracemap.texture.height };
-                        tracemap.visible = true;
-                        tracemap.alpha = 0.7f;
+                    // Load tracemap image file on a worker thread, placed over reference window once loaded
+                    TracemapJobData *jobData = (TracemapJobData *)RL_CALLOC(1, sizeof(TracemapJobData));
+                    jobData->position = (Vector2){ 48 + layout->refWindow.x, 48 + layout->refWindow.y };
 
-                        mainToolbarState.tracemapLoaded = true;
-                    }
-                    else inFileName[0] = '\0';
+                    SubmitFileJob(inFileName, ProcessLoadTracemapJob, CompleteLoadTracemapJob, jobData, &editorState);
                 }
 
                 if (result >= 0) showLoadTracemapDialog = false;
@@ -3469,15 +3748,37 @@ int main(int argc, char *argv[])
 
         EndDrawing();
         //----------------------------------------------------------------------------------
+
+#if defined(SUPPORT_STARTUP_TIMING)
+        if (!startupTimingReported)
+        {
+            double startupTimeFrame = GetTime();
+
+            printf("INFO: STARTUP: Window initialized:  %.2f ms\n", startupTimeWindow*1000.0);
+            printf("INFO: STARTUP: Layout loaded:       %.2f ms\n", (startupTimeLayout - startupTimeWindow)*1000.0);
+            printf("INFO: STARTUP: Editor initialized:  %.2f ms\n", (startupTimeEditor - startupTimeLayout)*1000.0);
+            printf("INFO: STARTUP: First frame drawn:   %.2f ms\n", (startupTimeFrame - startupTimeEditor)*1000.0);
+            printf("INFO: STARTUP: Time to first frame: %.2f ms\n", startupTimeFrame*1000.0);
+
+            startupTimingReported = true;
+        }
+#endif
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    CloseFileJobs();                        // Wait for pending file jobs (saving) and close worker threads
+
     UnloadLayout(layout);                   // Unload raygui layout
-    UnloadTexture(tracemap.texture);        // Unload tracemap texture (if loaded)
+    UnloadTracemap(&tracemap);              // Unload tracemap image and tiles (if loaded)
 
     RL_FREE(undoLayouts);                   // Free undo layouts array (allocated with RL_CALLOC)
-    RL_FREE(windowCodegenState.codeText);   // Free loaded codeText memory
+    UnloadVisualStylesCache();              // Unload cached styles fonts
+    UnloadGuiPanelControlsPalette(&windowControlsPaletteState);    // Unload controls palette preview texture
+    UnloadBackgroundGrid(&backgroundGrid);  // Unload background grid shader
+    GuiUnloadIconsAtlas();                  // Unload raygui icons atlas texture
+    CloseLayoutCodeAsync();                 // Cancel code generation jobs and close worker thread
+    GuiWindowCodegenSetCode(&windowCodegenState, NULL);     // Free loaded codeText memory (and lines index)
 
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -3505,19 +3806,26 @@ static void ShowCommandLineInfo(void)
 
     printf("USAGE:\n\n");
     printf("    > rguilayout [--help] --input <filename.ext> [--output <filename.ext>]\n");
-    printf("                 [--format <styleformat>] [--edit-prop <property> <value>]\n");
+    printf("                 [--template <filename.ext>] [--depfile [<filename.d>]] [--watch]\n");
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                      : Show tool version and command line usage help\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
-    printf("                                      Supported extensions: .rgl\n");
-    printf("    -o, --output <filename.ext>     : Define output file.\n");
-    printf("                                      Supported extensions: .c, .h\n");
+    printf("    -i, --input <filename.ext>      : Define input file, multiple inputs supported.\n");
+    printf("                                      Supported extensions: .rgl, .rgs (text style)\n");
+    printf("    -o, --output <filename.ext>     : Define output file, n-th output for n-th input.\n");
+    printf("                                      Supported extensions: .c, .h, .rgs (binary style)\n");
     printf("    -t, --template <filename.ext>   : Define code template for output.\n");
-    printf("                                      Supported extensions: .c, .h\n\n");
+    printf("                                      Supported extensions: .c, .h\n");
+    printf("    -MD, --depfile [<filename.d>]   : Write Makefile-syntax dependency file for output.\n");
+    printf("                                      Default file name: <output>.d\n");
+    printf("    -w, --watch                     : Keep running, regenerate outputs on input changes.\n");
+    printf("                                      Input files, template and style fonts are watched\n\n");
 
     printf("\nEXAMPLES:\n\n");
     printf("    > rguilayout --input mytool.rgl --output mytools.h\n");
+    printf("    > rguilayout --input mystyle.rgs --output mystyle_bin.rgs\n");
+    printf("    > rguilayout --input mytool.rgl --output mytool.h --template mytemplate.h -MD\n");
+    printf("    > rguilayout -i mytool.rgl -o mytool.h -i mystyle.rgs -o mystyle_bin.rgs --watch\n");
 }
 
 // Process command line input
@@ -3526,8 +3834,18 @@ static void ProcessCommandLine(int argc, char *argv[])
     // CLI required variables
     bool showUsageInfo = false;         // Toggle command line usage info
 
+    char inFileNames[MAX_CLI_INPUT_FILES][512] = { 0 };     // Input files names
+    char outFileNames[MAX_CLI_INPUT_FILES][512] = { 0 };    // Output files names (n-th output for n-th input)
+    int inFileCount = 0;
+    int outFileCount = 0;
+
     char templateFile[512] = { 0 };     // Template file name
 
+    bool exportDepFile = false;         // Export dependency file for build systems
+    char depFile[512] = { 0 };          // Dependency file name (default: <output>.d)
+
+    bool watchMode = false;             // Keep running and regenerate outputs on input changes
+
     int outputFormat = 0;               // Supported output formats
 
     // Process command line arguments
@@ -3542,12 +3860,17 @@ static void ProcessCommandLine(int argc, char *argv[])
             // Check for valid argument and valid file extension
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                if (IsFileExtension(argv[i + 1], ".rgl"))
+                if (inFileCount >= MAX_CLI_INPUT_FILES) LOG("WARNING: Too many input files\n");
+                else if (IsFileExtension(argv[i + 1], ".rgl") ||
+                         IsFileExtension(argv[i + 1], ".rgs"))
                 {
-                    strcpy(inFileName, argv[i + 1]);    // Read input filename
+                    strcpy(inFileNames[inFileCount], argv[i + 1]);    // Read input filename
                 }
                 else LOG("WARNING: Input file extension not recognized\n");
 
+                // NOTE: Input slot is used even if not recognized (skipped on processing), to keep inputs/outputs pairing
+                if (inFileCount < MAX_CLI_INPUT_FILES) inFileCount++;
+
                 i++;
             }
             else LOG("WARNING: No input file provided\n");
@@ -3556,13 +3879,18 @@ static void ProcessCommandLine(int argc, char *argv[])
         {
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                if (IsFileExtension(argv[i + 1], ".c") ||
-                    IsFileExtension(argv[i + 1], ".h"))
+                if (outFileCount >= MAX_CLI_INPUT_FILES) LOG("WARNING: Too many output files\n");
+                else if (IsFileExtension(argv[i + 1], ".c") ||
+                         IsFileExtension(argv[i + 1], ".h") ||
+                         IsFileExtension(argv[i + 1], ".rgs"))
                 {
-                    strcpy(outFileName, argv[i + 1]);   // Read output filename
+                    strcpy(outFileNames[outFileCount], argv[i + 1]);   // Read output filename
                 }
                 else LOG("WARNING: Output file extension not recognized\n");
 
+                // NOTE: Output slot is used even if not recognized, to keep inputs/outputs pairing
+                if (outFileCount < MAX_CLI_INPUT_FILES) outFileCount++;
+
                 i++;
             }
             else LOG("WARNING: No output file provided\n");
@@ -3582,54 +3910,313 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else LOG("WARNING: No template file provided\n");
         }
+        else if ((strcmp(argv[i], "-MD") == 0) || (strcmp(argv[i], "--depfile") == 0))
+        {
+            exportDepFile = true;
+
+            // Dependency file name is optional
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (IsFileExtension(argv[i + 1], ".d")) strcpy(depFile, argv[i + 1]);   // Read dependency filename
+                else LOG("WARNING: Dependency file extension not recognized\n");
+
+                i++;
+            }
+        }
+        else if ((strcmp(argv[i], "-w") == 0) || (strcmp(argv[i], "--watch") == 0))
+        {
+#if defined(SUPPORT_WATCH_MODE)
+            watchMode = true;
+#else
+            LOG("WARNING: Watch mode not supported on this platform, outputs generated once\n");
+#endif
+        }
 
         // TODO: CLI: Support codegen options: exportAnchors, defineRecs, fullComments...
     }
 
-    // Process input file
-    if (inFileName[0] != '\0')
+    // Remove not recognized inputs along with their paired outputs
+    int validFileCount = 0;
+    for (int i = 0; i < inFileCount; i++)
     {
-        // Set a default name for output in case not provided
-        if (outFileName[0] == '\0') strcpy(outFileName, "output.c");
+        if (inFileNames[i][0] == '\0') continue;
+
+        if (validFileCount != i)
+        {
+            strcpy(inFileNames[validFileCount], inFileNames[i]);
+            strcpy(outFileNames[validFileCount], outFileNames[i]);
+        }
 
-        LOG("\nInput file:       %s", inFileName);
-        LOG("\nOutput file:      %s", outFileName);
+        validFileCount++;
+    }
+    inFileCount = validFileCount;
 
-        // Support .rlg layout processing to generate .c
-        GuiLayout *layout = LoadLayout(inFileName);
+    if ((inFileCount > 1) && (depFile[0] != '\0'))
+    {
+        LOG("WARNING: Dependency file name ignored for multiple inputs, using <output>.d\n");
+        depFile[0] = '\0';
+    }
 
-        GuiLayoutConfig config = { 0 };
-        memset(&config, 0, sizeof(GuiLayoutConfig));
-        strcpy(config.name, "window_codegen");
-        strcpy(config.version, toolVersion);
-        strcpy(config.company, "raylib technologies");
-        strcpy(config.description, "tool description");
-        config.exportAnchors = true;
-        config.defineRecs = false;
-        config.fullComments = true;
-
-        // Generate C code for gui layout->controls
-        char *guiTemplateCustom = NULL;
-        if (templateFile[0] != '\0') guiTemplateCustom = LoadFileText(templateFile);
-
-        unsigned char *toolstr = NULL;
-        if (guiTemplateCustom != NULL)
+    // Process input files: text style conversion to binary style or layout code generation
+    for (int i = 0; i < inFileCount; i++)
+    {
+        // Set a default name for output in case not provided
+        // NOTE: With multiple inputs, default output is named after input to avoid overwriting
+        if (IsFileExtension(inFileNames[i], ".rgs"))
+        {
+            if ((outFileNames[i][0] == '\0') || !IsFileExtension(outFileNames[i], ".rgs"))
+            {
+                if (inFileCount == 1) strcpy(outFileNames[i], "output.rgs");
+                else strcpy(outFileNames[i], TextFormat("%s/%s_bin.rgs", GetDirectoryPath(inFileNames[i]), GetFileNameWithoutExt(inFileNames[i])));
+            }
+        }
+        else if (outFileNames[i][0] == '\0')
         {
-            toolstr = GenLayoutCode(guiTemplateCustom, layout, (Vector2){ 0, 0 }, config);
-            RL_FREE(guiTemplateCustom);
+            if (inFileCount == 1) strcpy(outFileNames[i], "output.c");
+            else strcpy(outFileNames[i], TextFormat("%s/%s.c", GetDirectoryPath(inFileNames[i]), GetFileNameWithoutExt(inFileNames[i])));
         }
-        else toolstr = GenLayoutCode(guiTemplateStandardCode, layout, (Vector2){ 0, 0 }, config);
 
-        FILE *ftool = fopen(outFileName, "wt");
-        fprintf(ftool, toolstr);    // Write code string to file
-        fclose(ftool);
+        GenerateOutputFile(inFileNames[i], outFileNames[i], templateFile, exportDepFile? depFile : NULL);
+    }
 
-        UnloadLayout(layout);
-        RL_FREE(toolstr);
+#if defined(SUPPORT_WATCH_MODE)
+    if (watchMode)
+    {
+        if (inFileCount > 0) WatchOutputFiles(inFileNames, outFileNames, inFileCount, templateFile, exportDepFile? depFile : NULL);
+        else LOG("WARNING: No input files to watch\n");
     }
+#endif
 
     if (showUsageInfo) ShowCommandLineInfo();
 }
+
+// Generate output file from input file: layout code (.rgl -> .c/.h) or binary style (.rgs -> .rgs)
+// NOTE: Dependency file is only exported if depFileName is provided (empty for <output>.d) and output generation succeeds
+static bool GenerateOutputFile(const char *inFileName, const char *outFileName, const char *templateFileName, const char *depFileName)
+{
+    bool result = false;
+
+    LOG("\nInput file:       %s", inFileName);
+    LOG("\nOutput file:      %s", outFileName);
+
+    if (!FileExists(inFileName)) LOG("\nWARNING: Input file could not be found\n");
+    else if (IsFileExtension(inFileName, ".rgs"))
+    {
+        result = ExportStyleAsBinary(inFileName, outFileName);
+
+        if (!result) LOG("\nWARNING: Style could not be converted\n");
+    }
+    else
+    {
+        // Support .rlg layout processing to generate .c
+        GuiLayout *layout = LoadLayout(inFileName);
+
+        if (layout == NULL) LOG("\nWARNING: Layout file could not be loaded\n");
+        else
+        {
+            GuiLayoutConfig config = { 0 };
+            memset(&config, 0, sizeof(GuiLayoutConfig));
+            strcpy(config.name, "window_codegen");
+            strcpy(config.version, toolVersion);
+            strcpy(config.company, "raylib technologies");
+            strcpy(config.description, "tool description");
+            config.exportAnchors = true;
+            config.defineRecs = false;
+            config.fullComments = true;
+
+            // Generate C code for gui layout->controls
+            char *guiTemplateCustom = NULL;
+            if (templateFileName[0] != '\0') guiTemplateCustom = LoadFileText(templateFileName);
+
+            unsigned char *toolstr = NULL;
+            if (guiTemplateCustom != NULL)
+            {
+                toolstr = GenLayoutCode(guiTemplateCustom, layout, (Vector2){ 0, 0 }, config);
+                RL_FREE(guiTemplateCustom);
+            }
+            else toolstr = GenLayoutCode(guiTemplateStandardCode, layout, (Vector2){ 0, 0 }, config);
+
+            FILE *ftool = fopen(outFileName, "wt");
+
+            if (ftool != NULL)
+            {
+                fprintf(ftool, toolstr);    // Write code string to file
+                fclose(ftool);
+                result = true;
+            }
+            else LOG("\nWARNING: Output file could not be written\n");
+
+            UnloadLayout(layout);
+            RL_FREE(toolstr);
+        }
+    }
+
+    if (result && (depFileName != NULL))
+    {
+        char depFileNames[MAX_OUTPUT_DEPENDENCIES][512] = { 0 };
+        const char *depFileNamesPtr[MAX_OUTPUT_DEPENDENCIES] = { 0 };
+        int depCount = GetOutputDependencies(inFileName, templateFileName, depFileNames);
+
+        for (int i = 0; i < depCount; i++) depFileNamesPtr[i] = depFileNames[i];
+
+        if (depFileName[0] == '\0') depFileName = TextFormat("%s.d", outFileName);
+        if (ExportDependencyFile(depFileName, outFileName, depFileNamesPtr, depCount)) LOG("\nDependency file:  %s", depFileName);
+    }
+
+    return result;
+}
+
+// Get files required to generate output from input file, returns files count
+// NOTE: Layout code depends on layout and custom template (if provided),
+// binary style depends on text style and the font and charmap files referenced by it
+static int GetOutputDependencies(const char *inFileName, const char *templateFileName, char (*depFileNames)[512])
+{
+    int depCount = 0;
+
+    strcpy(depFileNames[depCount++], inFileName);
+
+    if (IsFileExtension(inFileName, ".rgs"))
+    {
+        FILE *rgsFile = fopen(inFileName, "rt");
+
+        if (rgsFile != NULL)
+        {
+            char buffer[256] = { 0 };
+            char fontFileName[256] = { 0 };
+            char charmapFileName[256] = { 0 };
+            int fontSize = 0;
+
+            while (fgets(buffer, 256, rgsFile) != NULL)
+            {
+                // Style font: f <gen_font_size> <charmap_file> <font_file>
+                if ((buffer[0] == 'f') && (sscanf(buffer, "f %d %s %[^\r\n]s", &fontSize, charmapFileName, fontFileName) == 3)) break;
+            }
+
+            fclose(rgsFile);
+
+            // NOTE: Style font and charmap files are relative to style file, same as ExportStyleAsBinary()
+            if (fontFileName[0] != '\0') strcpy(depFileNames[depCount++], TextFormat("%s/%s", GetDirectoryPath(inFileName), fontFileName));
+            if ((charmapFileName[0] != '\0') && (charmapFileName[0] != '0')) strcpy(depFileNames[depCount++], TextFormat("%s/%s", GetDirectoryPath(inFileName), charmapFileName));
+        }
+    }
+    else if (templateFileName[0] != '\0') strcpy(depFileNames[depCount++], templateFileName);
+
+    return depCount;
+}
+
+#if defined(SUPPORT_WATCH_MODE)
+// Watch input files (and their dependencies), regenerate affected outputs on changes
+// NOTE: Process stays resident until terminated, changes bursts are debounced (WATCH_DEBOUNCE_TIME).
+// Containing directories are watched instead of files, most editors save by renaming a temporary file
+static void WatchOutputFiles(char (*inFileNames)[512], char (*outFileNames)[512], int fileCount, const char *templateFileName, const char *depFileName)
+{
+    int watchFd = inotify_init1(IN_CLOEXEC);
+
+    if (watchFd < 0)
+    {
+        LOG("WARNING: Watch mode could not be initialized\n");
+        return;
+    }
+
+    char depFileNames[MAX_CLI_INPUT_FILES][MAX_OUTPUT_DEPENDENCIES][512] = { 0 };  // Files required by every output
+    int depWatches[MAX_CLI_INPUT_FILES][MAX_OUTPUT_DEPENDENCIES] = { 0 };          // Watch descriptor of every file directory
+    int depCounts[MAX_CLI_INPUT_FILES] = { 0 };
+    bool outputsDirty[MAX_CLI_INPUT_FILES] = { 0 };     // Outputs pending regeneration
+    bool updateWatches = true;                          // Dependencies could have changed, watches update required
+    bool changesPending = false;
+
+    // NOTE: Buffer aligned as required by inotify events
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    LOG("\nWatching %i input files for changes...\n", fileCount);
+
+    while (true)
+    {
+        if (updateWatches)
+        {
+            // NOTE: Adding a watch to an already watched directory returns the same descriptor
+            for (int i = 0; i < fileCount; i++)
+            {
+                depCounts[i] = GetOutputDependencies(inFileNames[i], templateFileName, depFileNames[i]);
+
+                for (int d = 0; d < depCounts[i]; d++)
+                {
+                    depWatches[i][d] = inotify_add_watch(watchFd, GetDirectoryPath(depFileNames[i][d]), IN_CLOSE_WRITE | IN_MOVED_TO);
+                    if (depWatches[i][d] < 0) LOG("WARNING: [%s] File could not be watched\n", depFileNames[i][d]);
+                }
+            }
+
+            updateWatches = false;
+        }
+
+        // Wait for changes, once changes are detected wait until no more changes happen in debounce time
+        struct pollfd pollFd = { watchFd, POLLIN, 0 };
+        int ready = poll(&pollFd, 1, changesPending? WATCH_DEBOUNCE_TIME : -1);
+
+        if (ready < 0)
+        {
+            if (errno == EINTR) continue;
+            break;
+        }
+        else if (ready == 0)
+        {
+            // Regenerate affected outputs only
+            for (int i = 0; i < fileCount; i++)
+            {
+                if (outputsDirty[i])
+                {
+                    GenerateOutputFile(inFileNames[i], outFileNames[i], templateFileName, depFileName);
+                    outputsDirty[i] = false;
+                }
+            }
+
+            LOG("\n");
+            changesPending = false;
+            updateWatches = true;
+            continue;
+        }
+
+        int length = (int)read(watchFd, buffer, sizeof(buffer));
+
+        if (length < 0)
+        {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        for (char *ptr = buffer; ptr < (buffer + length); )
+        {
+            const struct inotify_event *event = (const struct inotify_event *)ptr;
+
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                // Events lost, all outputs must be regenerated
+                for (int i = 0; i < fileCount; i++) outputsDirty[i] = true;
+                changesPending = true;
+            }
+            else if (event->len > 0)
+            {
+                for (int i = 0; i < fileCount; i++)
+                {
+                    for (int d = 0; d < depCounts[i]; d++)
+                    {
+                        if ((depWatches[i][d] == event->wd) && (strcmp(GetFileName(depFileNames[i][d]), event->name) == 0))
+                        {
+                            outputsDirty[i] = true;
+                            changesPending = true;
+                        }
+                    }
+                }
+            }
+
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+
+    close(watchFd);
+}
+#endif
+
 #endif      // PLATFORM_DESKTOP
 
 //--------------------------------------------------------------------------------------------
@@ -3731,6 +4318,12 @@ static GuiLayout *LoadLayout(const char *fileName)
                 layout->anchors[i].y += layout->refWindow.y;
             }
         }
+        else
+        {
+            // Layout file could not be opened
+            RL_FREE(layout);
+            layout = NULL;
+        }
     }
     else
     {
@@ -3752,6 +4345,18 @@ static void UnloadLayout(GuiLayout *layout)
     RL_FREE(layout);
 }
 
+// Copy layout, anchors references remapped to copy
+// NOTE: Anchor id is the anchor index in the layout anchors array
+static GuiLayout *CopyLayout(const GuiLayout *layout)
+{
+    GuiLayout *copy = (GuiLayout *)RL_MALLOC(sizeof(GuiLayout));
+
+    memcpy(copy, layout, sizeof(GuiLayout));
+    for (int i = 0; i < layout->controlCount; i++) copy->controls[i].ap = &copy->anchors[layout->controls[i].ap->id];
+
+    return copy;
+}
+
 // Reset layout to default values
 static void ResetLayout(GuiLayout *layout)
 {
@@ -3766,7 +4371,7 @@ static void ResetLayout(GuiLayout *layout)
         memset(layout->anchors[i].name, 0, MAX_ANCHOR_NAME_LENGTH);
 
         if (i == 0) strcpy(layout->anchors[i].name, "refPoint");
-        else strcpy(layout->anchors[i].name, TextFormat("anchor%02i", i));
+        else snprintf(layout->anchors[i].name, MAX_ANCHOR_NAME_LENGTH, "anchor%02i", i);   // NOTE: TextFormat() not used, layouts are loaded on worker threads
     }
 
     // Initialize layout controls data
@@ -3787,7 +4392,7 @@ static void ResetLayout(GuiLayout *layout)
 }
 
 // Save layout information as text file
-static void SaveLayout(GuiLayout *layout, const char *fileName)
+static bool SaveLayout(GuiLayout *layout, const char *fileName)
 {
     #define RGL_FILE_VERSION_TEXT "4.1"
 
@@ -3953,6 +4558,257 @@ static void SaveLayout(GuiLayout *layout, const char *fileName)
         }
     }
 */
+
+    return (rglFile != NULL);
+}
+
+#if defined(PLATFORM_DESKTOP)
+// Export text style file (.rgs) as binary style file (.rgs)
+// NOTE: Font is rasterized on conversion (no GPU required), binary style contains properties,
+// prebaked glyphs data and compressed font atlas, loaded with a single read and one texture upload
+// by GuiLoadStyle() or GuiLoadStyleFromMemory()
+static bool ExportStyleAsBinary(const char *fileName, const char *outFileName)
+{
+    #define MAX_STYLE_PROPERTIES    1024
+    #define STYLE_FONT_PADDING         4    // Font atlas glyphs padding, same as raylib LoadFontEx()
+
+    FILE *rgsFile = fopen(fileName, "rt");
+    if (rgsFile == NULL) return false;
+
+    short propsControlId[MAX_STYLE_PROPERTIES] = { 0 };
+    short propsPropertyId[MAX_STYLE_PROPERTIES] = { 0 };
+    unsigned int propsValue[MAX_STYLE_PROPERTIES] = { 0 };
+    int propertyCount = 0;
+
+    int fontSize = 0;
+    char charmapFileName[256] = { 0 };
+    char fontFileName[256] = { 0 };
+
+    char buffer[256] = { 0 };
+    fgets(buffer, 256, rgsFile);
+
+    // Text style files start with a comment line
+    bool textStyle = (buffer[0] == '#');
+
+    while (textStyle && !feof(rgsFile))
+    {
+        switch (buffer[0])
+        {
+            case 'p':
+            {
+                // Style property: p <control_id> <property_id> <property_value> <property_name>
+                int controlId = 0;
+                int propertyId = 0;
+                unsigned int propertyValue = 0;
+
+                if ((propertyCount < MAX_STYLE_PROPERTIES) && (sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue) == 3))
+                {
+                    propsControlId[propertyCount] = (short)controlId;
+                    propsPropertyId[propertyCount] = (short)propertyId;
+                    propsValue[propertyCount] = propertyValue;
+                    propertyCount++;
+                }
+            } break;
+            case 'f':
+            {
+                // Style font: f <gen_font_size> <charmap_file> <font_file>
+                sscanf(buffer, "f %d %s %[^\r\n]s", &fontSize, charmapFileName, fontFileName);
+            } break;
+            default: break;
+        }
+
+        fgets(buffer, 256, rgsFile);
+    }
+
+    fclose(rgsFile);
+
+    if (!textStyle) return false;
+
+    FILE *outFile = fopen(outFileName, "wb");
+    if (outFile == NULL) return false;
+
+    // Write style header and properties
+    short version = 400;
+    short reserved = 0;
+
+    fwrite("rGS ", 1, 4, outFile);
+    fwrite(&version, sizeof(short), 1, outFile);
+    fwrite(&reserved, sizeof(short), 1, outFile);
+    fwrite(&propertyCount, sizeof(int), 1, outFile);
+
+    for (int i = 0; i < propertyCount; i++)
+    {
+        fwrite(&propsControlId[i], sizeof(short), 1, outFile);
+        fwrite(&propsPropertyId[i], sizeof(short), 1, outFile);
+        fwrite(&propsValue[i], sizeof(unsigned int), 1, outFile);
+    }
+
+    // Rasterize font glyphs and atlas
+    int fontDataSize = 0;
+    unsigned char *fontFileData = NULL;
+    if (fontFileName[0] != '\0') fontFileData = LoadFileData(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), &fontDataSize);
+
+    int *codepoints = NULL;
+    int codepointCount = 0;
+
+    if ((fontFileData != NULL) && (charmapFileName[0] != '0'))
+    {
+        // Load text data from file
+        // NOTE: Expected an UTF-8 array of codepoints, no separation
+        char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
+        if (textData != NULL) codepoints = LoadCodepoints(textData, &codepointCount);
+        UnloadFileText(textData);
+    }
+
+    int glyphCount = (codepointCount > 0)? codepointCount : 95;     // Default to 95 standard codepoints
+    GlyphInfo *glyphs = NULL;
+    if (fontFileData != NULL) glyphs = LoadFontData(fontFileData, fontDataSize, fontSize, codepoints, codepointCount, FONT_DEFAULT);
+
+    UnloadCodepoints(codepoints);
+    UnloadFileData(fontFileData);
+
+    if (glyphs == NULL)
+    {
+        // No font available, style keeps current font on loading
+        int noFontDataSize = 0;
+        fwrite(&noFontDataSize, sizeof(int), 1, outFile);
+    }
+    else
+    {
+        Rectangle *recs = NULL;
+        Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCount, fontSize, STYLE_FONT_PADDING, 0);
+
+        // Compress font atlas image, recs and glyphs data (DEFLATE)
+        int atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+        int atlasCompSize = 0;
+        unsigned char *atlasCompData = CompressData(atlas.data, atlasDataSize, &atlasCompSize);
+
+        int recsCompSize = 0;
+        unsigned char *recsCompData = CompressData((unsigned char *)recs, glyphCount*sizeof(Rectangle), &recsCompSize);
+
+        unsigned char *glyphsData = (unsigned char *)RL_CALLOC(glyphCount, 16);   // 16 bytes data per glyph
+        for (int i = 0; i < glyphCount; i++)
+        {
+            memcpy(glyphsData + i*16, &glyphs[i].value, sizeof(int));
+            memcpy(glyphsData + i*16 + 4, &glyphs[i].offsetX, sizeof(int));
+            memcpy(glyphsData + i*16 + 8, &glyphs[i].offsetY, sizeof(int));
+            memcpy(glyphsData + i*16 + 12, &glyphs[i].advanceX, sizeof(int));
+        }
+
+        int glyphsCompSize = 0;
+        unsigned char *glyphsCompData = CompressData(glyphsData, glyphCount*16, &glyphsCompSize);
+
+        // Write font data: info, white rectangle, atlas image, recs and glyphs
+        // NOTE: White rectangle is not defined for converted fonts, shapes texture is not changed on loading
+        int fontType = 0;   // 0-Normal, 1-SDF
+        Rectangle fontWhiteRec = { 0 };
+        int fontInfoSize = 12 + 16 + 8 + 12 + atlasCompSize + 4 + recsCompSize + 4 + glyphsCompSize;
+
+        fwrite(&fontInfoSize, sizeof(int), 1, outFile);
+        fwrite(&fontSize, sizeof(int), 1, outFile);
+        fwrite(&glyphCount, sizeof(int), 1, outFile);
+        fwrite(&fontType, sizeof(int), 1, outFile);
+        fwrite(&fontWhiteRec, sizeof(Rectangle), 1, outFile);
+        fwrite(&atlasDataSize, sizeof(int), 1, outFile);
+        fwrite(&atlasCompSize, sizeof(int), 1, outFile);
+        fwrite(&atlas.width, sizeof(int), 1, outFile);
+        fwrite(&atlas.height, sizeof(int), 1, outFile);
+        fwrite(&atlas.format, sizeof(int), 1, outFile);
+        fwrite(atlasCompData, 1, atlasCompSize, outFile);
+        fwrite(&recsCompSize, sizeof(int), 1, outFile);
+        fwrite(recsCompData, 1, recsCompSize, outFile);
+        fwrite(&glyphsCompSize, sizeof(int), 1, outFile);
+        fwrite(glyphsCompData, 1, glyphsCompSize, outFile);
+
+        MemFree(atlasCompData);
+        MemFree(recsCompData);
+        MemFree(glyphsCompData);
+        RL_FREE(glyphsData);
+        RL_FREE(recs);
+        UnloadImage(atlas);
+        UnloadFontData(glyphs, glyphCount);
+    }
+
+    fclose(outFile);
+
+    return true;
+}
+
+// Export Makefile-syntax dependency file (.d): target depends on all provided files
+// NOTE: An empty rule is added for every dependency (like gcc -MP), so deleted files do not break builds
+static bool ExportDependencyFile(const char *fileName, const char *targetFileName, const char **depFileNames, int depCount)
+{
+    FILE *depFile = fopen(fileName, "wt");
+    if (depFile == NULL) return false;
+
+    // Write target rule and an empty rule for every dependency
+    for (int i = 0; i < (2*depCount + 1); i++)
+    {
+        const char *name = (i == 0)? targetFileName : depFileNames[(i - 1)%depCount];
+
+        if ((i > 0) && (i <= depCount)) fprintf(depFile, " \\\n ");
+        else if (i > depCount) fprintf(depFile, "\n\n");
+
+        // Escape file name characters with special meaning in Makefiles
+        for (int c = 0; name[c] != '\0'; c++)
+        {
+            if ((name[c] == ' ') || (name[c] == '#')) fputc('\\', depFile);
+            else if (name[c] == '$') fputc('$', depFile);
+            fputc(name[c], depFile);
+        }
+
+        if ((i == 0) || (i > depCount)) fputc(':', depFile);
+    }
+
+    fprintf(depFile, "\n");
+
+    fclose(depFile);
+
+    return true;
+}
+#endif
+
+// Reset undo levels to current layout
+// NOTE: Only current level is initialized, undo/redo never reach a level before it is pushed
+static void ResetUndoLayouts(GuiLayout *undoLayouts, int *currentUndoIndex, int *firstUndoIndex, int *lastUndoIndex, const GuiLayout *layout)
+{
+    *currentUndoIndex = 0;
+    *firstUndoIndex = 0;
+    *lastUndoIndex = 0;
+
+    memcpy(&undoLayouts[0], layout, sizeof(GuiLayout));
+}
+
+// Record a new undo level in the undo ring buffer, only if layout changed from current level
+// NOTE: Bulk edition operations record a level before and after the operation,
+// so every operation can be undone as a single step
+static bool PushUndoLayout(GuiLayout *undoLayouts, int *currentUndoIndex, int *firstUndoIndex, int *lastUndoIndex, const GuiLayout *layout)
+{
+    bool recorded = false;
+
+    if (memcmp(&undoLayouts[*currentUndoIndex], layout, sizeof(GuiLayout)) != 0)
+    {
+        // Move cursor to next available position to record undo
+        (*currentUndoIndex)++;
+        if (*currentUndoIndex >= MAX_UNDO_LEVELS) *currentUndoIndex = 0;
+        if (*currentUndoIndex == *firstUndoIndex) (*firstUndoIndex)++;
+        if (*firstUndoIndex >= MAX_UNDO_LEVELS) *firstUndoIndex = 0;
+
+        memcpy(&undoLayouts[*currentUndoIndex], layout, sizeof(GuiLayout));
+
+        *lastUndoIndex = *currentUndoIndex;
+
+        // Set a '*' mark on loaded file name to notice save requirement
+        if ((inFileName[0] != '\0') && !saveChangesRequired)
+        {
+            SetWindowTitle(TextFormat("%s v%s - %s*", toolName, toolVersion, GetFileName(inFileName)));
+            saveChangesRequired = true;
+        }
+
+        recorded = true;
+    }
+
+    return recorded;
 }
 
 // Check if a rectangle is contained within another
@@ -4024,3 +4880,905 @@ static bool IsFileNameValid(const char *fileName)
 
     return valid;
 }
+
+// Get control rectangle in screen space
+// NOTE: Controls linked to anchor[0] (refWindow) already store screen-space position
+static Rectangle GetControlScreenRec(const GuiLayoutControl *control)
+{
+    Rectangle rec = control->rec;
+
+    if (control->ap->id > 0)
+    {
+        rec.x += control->ap->x;
+        rec.y += control->ap->y;
+    }
+
+    return rec;
+}
+
+//--------------------------------------------------------------------------------------------
+// Layout controls selection functions
+//--------------------------------------------------------------------------------------------
+// Clear selection
+// NOTE: Only selected bits are cleared, no need to reset full bitset
+static void ClearSelection(GuiLayoutSelection *selection)
+{
+    for (int i = 0; i < selection->count; i++) selection->bits[selection->indices[i]/32] &= ~(1u << (selection->indices[i]%32));
+    selection->count = 0;
+}
+
+// Check if control slot is selected
+static bool IsControlSelected(const GuiLayoutSelection *selection, int index)
+{
+    if ((index < 0) || (index >= MAX_GUI_CONTROLS)) return false;
+
+    return ((selection->bits[index/32] & (1u << (index%32))) != 0);
+}
+
+// Add control slot to selection
+static void SelectControl(GuiLayoutSelection *selection, int index)
+{
+    if ((index < 0) || (index >= MAX_GUI_CONTROLS) || IsControlSelected(selection, index)) return;
+
+    selection->bits[index/32] |= (1u << (index%32));
+    selection->indices[selection->count] = index;
+    selection->position[index] = selection->count;
+    selection->count++;
+}
+
+// Remove control slot from selection
+// NOTE: Last dense list entry is moved to the removed position, selection order is not kept
+static void UnselectControl(GuiLayoutSelection *selection, int index)
+{
+    if (!IsControlSelected(selection, index)) return;
+
+    int position = selection->position[index];
+    int lastIndex = selection->indices[selection->count - 1];
+
+    selection->indices[position] = lastIndex;
+    selection->position[lastIndex] = position;
+    selection->count--;
+
+    selection->bits[index/32] &= ~(1u << (index%32));
+}
+
+// Toggle control slot selection state
+static void ToggleControlSelection(GuiLayoutSelection *selection, int index)
+{
+    if (IsControlSelected(selection, index)) UnselectControl(selection, index);
+    else SelectControl(selection, index);
+}
+
+// Update selection on controls order swap (controls array positions exchanged)
+static void SwapSelectionSlots(GuiLayoutSelection *selection, int indexA, int indexB)
+{
+    bool selectedA = IsControlSelected(selection, indexA);
+    bool selectedB = IsControlSelected(selection, indexB);
+
+    // NOTE: Nothing to update if both slots share the same state
+    if (selectedA == selectedB) return;
+
+    int from = selectedA? indexA : indexB;
+    int to = selectedA? indexB : indexA;
+
+    selection->indices[selection->position[from]] = to;
+    selection->position[to] = selection->position[from];
+    selection->bits[from/32] &= ~(1u << (from%32));
+    selection->bits[to/32] |= (1u << (to%32));
+}
+
+//--------------------------------------------------------------------------------------------
+// Layout controls bulk edition functions
+//--------------------------------------------------------------------------------------------
+// Move selected controls
+static void MoveSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, float offsetX, float offsetY)
+{
+    for (int i = 0; i < selection->count; i++)
+    {
+        layout->controls[selection->indices[i]].rec.x += offsetX;
+        layout->controls[selection->indices[i]].rec.y += offsetY;
+    }
+}
+
+// Resize selected controls
+static void ResizeSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, float offsetWidth, float offsetHeight)
+{
+    for (int i = 0; i < selection->count; i++)
+    {
+        Rectangle *rec = &layout->controls[selection->indices[i]].rec;
+
+        rec->width += offsetWidth;
+        rec->height += offsetHeight;
+
+        // Minimum size limit
+        if (rec->width < MIN_CONTROL_SIZE) rec->width = MIN_CONTROL_SIZE;
+        if (rec->height < MIN_CONTROL_SIZE) rec->height = MIN_CONTROL_SIZE;
+    }
+}
+
+// Align selected controls to selection bounds
+// NOTE: Alignment is computed in screen space, controls could be linked to different anchors
+static void AlignSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, int alignment)
+{
+    if (selection->count < 2) return;
+
+    // Get selection bounds
+    Rectangle rec = GetControlScreenRec(&layout->controls[selection->indices[0]]);
+    float minX = rec.x, minY = rec.y;
+    float maxX = rec.x + rec.width, maxY = rec.y + rec.height;
+
+    for (int i = 1; i < selection->count; i++)
+    {
+        rec = GetControlScreenRec(&layout->controls[selection->indices[i]]);
+
+        if (rec.x < minX) minX = rec.x;
+        if (rec.y < minY) minY = rec.y;
+        if ((rec.x + rec.width) > maxX) maxX = rec.x + rec.width;
+        if ((rec.y + rec.height) > maxY) maxY = rec.y + rec.height;
+    }
+
+    for (int i = 0; i < selection->count; i++)
+    {
+        GuiLayoutControl *control = &layout->controls[selection->indices[i]];
+        rec = GetControlScreenRec(control);
+
+        switch (alignment)
+        {
+            case CONTROLS_ALIGN_LEFT: control->rec.x += (minX - rec.x); break;
+            case CONTROLS_ALIGN_RIGHT: control->rec.x += (maxX - (rec.x + rec.width)); break;
+            case CONTROLS_ALIGN_TOP: control->rec.y += (minY - rec.y); break;
+            case CONTROLS_ALIGN_BOTTOM: control->rec.y += (maxY - (rec.y + rec.height)); break;
+            default: break;
+        }
+    }
+}
+
+// Compare selected controls by screen position, required by qsort()
+static int CompareSelectionSortItems(const void *a, const void *b)
+{
+    float posA = ((const SelectionSortItem *)a)->position;
+    float posB = ((const SelectionSortItem *)b)->position;
+
+    return (posA > posB) - (posA < posB);
+}
+
+// Distribute selected controls with equal spacing between them
+// NOTE: First and last controls (by screen position) keep their position
+static void DistributeSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, bool vertical)
+{
+    if (selection->count < 3) return;
+
+    SelectionSortItem items[MAX_GUI_CONTROLS] = { 0 };
+    float totalSize = 0.0f;
+
+    for (int i = 0; i < selection->count; i++)
+    {
+        Rectangle rec = GetControlScreenRec(&layout->controls[selection->indices[i]]);
+
+        items[i].index = selection->indices[i];
+        items[i].position = vertical? rec.y : rec.x;
+        totalSize += vertical? rec.height : rec.width;
+    }
+
+    qsort(items, selection->count, sizeof(SelectionSortItem), CompareSelectionSortItems);
+
+    Rectangle firstRec = GetControlScreenRec(&layout->controls[items[0].index]);
+    Rectangle lastRec = GetControlScreenRec(&layout->controls[items[selection->count - 1].index]);
+
+    float start = vertical? firstRec.y : firstRec.x;
+    float end = vertical? (lastRec.y + lastRec.height) : (lastRec.x + lastRec.width);
+    float spacing = ((end - start) - totalSize)/(selection->count - 1);
+    float position = start;
+
+    for (int i = 0; i < selection->count; i++)
+    {
+        GuiLayoutControl *control = &layout->controls[items[i].index];
+        Rectangle rec = GetControlScreenRec(control);
+
+        if (vertical)
+        {
+            control->rec.y += ((int)position - rec.y);
+            position += (rec.height + spacing);
+        }
+        else
+        {
+            control->rec.x += ((int)position - rec.x);
+            position += (rec.width + spacing);
+        }
+    }
+}
+
+// Link selected controls to anchor
+// NOTE: Controls keep their screen position, linking to anchor[0] unlinks them
+static void LinkSelectedControls(GuiLayout *layout, const GuiLayoutSelection *selection, GuiAnchorPoint *anchor)
+{
+    for (int i = 0; i < selection->count; i++)
+    {
+        GuiLayoutControl *control = &layout->controls[selection->indices[i]];
+
+        if (control->ap->id > 0)
+        {
+            control->rec.x += control->ap->x;
+            control->rec.y += control->ap->y;
+        }
+
+        control->ap = anchor;
+
+        if (anchor->id > 0)
+        {
+            control->rec.x -= anchor->x;
+            control->rec.y -= anchor->y;
+        }
+    }
+}
+
+// Duplicate selected controls
+// NOTE: Duplicates are added at the end of the layout (in selection order) and replace current selection
+static bool DuplicateSelectedControls(GuiLayout *layout, GuiLayoutSelection *selection)
+{
+    if ((selection->count == 0) || ((layout->controlCount + selection->count) > MAX_GUI_CONTROLS)) return false;
+
+    int firstIndex = layout->controlCount;
+
+    for (int i = 0; i < selection->count; i++)
+    {
+        GuiLayoutControl *control = &layout->controls[layout->controlCount];
+
+        *control = layout->controls[selection->indices[i]];
+        control->id = layout->controlCount;
+        control->rec.x += 10;
+        control->rec.y += 10;
+        strcpy(control->name, TextFormat("%s%03i", controlTypeName[control->type], layout->controlCount));
+
+        layout->controlCount++;
+    }
+
+    ClearSelection(selection);
+    for (int i = firstIndex; i < layout->controlCount; i++) SelectControl(selection, i);
+
+    return true;
+}
+
+// Load embedded visual style
+// NOTE: Style properties table and font are cached on first load, next loads just restore them
+static void LoadVisualStyle(int style)
+{
+    // Detach current font if owned by the cache, so GuiLoadStyleDefault() does not unload it
+    Font currentFont = GuiGetFont();
+
+    for (int i = 1; i < MAX_GUI_STYLES_AVAILABLE; i++)
+    {
+        if (styleCache[i].loaded && (styleCache[i].font.texture.id == currentFont.texture.id))
+        {
+            Font defaultFont = GetFontDefault();
+            Rectangle whiteChar = defaultFont.recs[95];
+
+            GuiSetFont(defaultFont);
+            SetShapesTexture(defaultFont.texture, (Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 });
+            break;
+        }
+    }
+
+    // Reset to default internal style
+    // NOTE: Required to unload any previously loaded (not cached) font texture
+    GuiLoadStyleDefault();
+
+    if ((style <= 0) || (style >= MAX_GUI_STYLES_AVAILABLE)) return;
+
+    if (!styleCache[style].loaded)
+    {
+        switch (style)
+        {
+            case 1: GuiLoadStyleJungle(); break;
+            case 2: GuiLoadStyleCandy(); break;
+            case 3: GuiLoadStyleLavanda(); break;
+            case 4: GuiLoadStyleCyber(); break;
+            case 5: GuiLoadStyleTerminal(); break;
+            case 6: GuiLoadStyleAshes(); break;
+            case 7: GuiLoadStyleBluish(); break;
+            case 8: GuiLoadStyleDark(); break;
+            case 9: GuiLoadStyleCherry(); break;
+            case 10: GuiLoadStyleSunny(); break;
+            case 11: GuiLoadStyleEnefete(); break;
+            default: break;
+        }
+
+        // Store resulting properties table and font
+        for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+            {
+                styleCache[style].props[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] = GuiGetStyle(i, j);
+            }
+        }
+
+        styleCache[style].font = GuiGetFont();
+        styleCache[style].loaded = true;
+    }
+    else
+    {
+        // Restore properties table
+        // NOTE: DEFAULT control properties are set first, base ones are propagated to all controls on set
+        for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+            {
+                GuiSetStyle(i, j, styleCache[style].props[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j]);
+            }
+        }
+
+        // Restore font and white rectangle used on shapes drawing
+        // NOTE: Embedded styles fonts place the white rectangle on atlas bottom-right corner
+        Font font = styleCache[style].font;
+        GuiSetFont(font);
+        SetShapesTexture(font.texture, (Rectangle){ (float)font.texture.width - 2, (float)font.texture.height - 2, 1, 1 });
+    }
+}
+
+// Unload embedded visual styles cache (fonts)
+static void UnloadVisualStylesCache(void)
+{
+    // Get back to default style, current font could be a cached one
+    LoadVisualStyle(0);
+
+    for (int i = 1; i < MAX_GUI_STYLES_AVAILABLE; i++)
+    {
+        if (styleCache[i].loaded)
+        {
+            UnloadTexture(styleCache[i].font.texture);
+            RAYGUI_FREE(styleCache[i].font.recs);
+            RAYGUI_FREE(styleCache[i].font.glyphs);
+        }
+    }
+
+    memset(styleCache, 0, sizeof(styleCache));
+}
+
+// Load tracemap image as mipmap levels
+// NOTE: No GPU upload is done (it can be called from worker threads), last level is uploaded
+// as preview on tracemap job completion and remaining tiles are streamed on draw
+static bool LoadTracemapLevels(Tracemap *tracemap, const char *fileName)
+{
+    Image image = LoadImage(fileName);
+
+    if (image.data == NULL) return false;
+
+    // NOTE: Tracemap keeps original image size, downscaled level 0 is just drawn stretched
+    tracemap->width = image.width;
+    tracemap->height = image.height;
+
+    // Downscale level 0 (keeping aspect ratio) to bound CPU memory used by levels
+    // NOTE: Resized before format conversion to avoid a full resolution RGBA8 copy
+    if ((image.width > TRACEMAP_MAX_IMAGE_SIZE) || (image.height > TRACEMAP_MAX_IMAGE_SIZE))
+    {
+        float scale = (float)TRACEMAP_MAX_IMAGE_SIZE/(float)((image.width > image.height)? image.width : image.height);
+        int width = (int)(image.width*scale);
+        int height = (int)(image.height*scale);
+
+        ImageResize(&image, (width > 1)? width : 1, (height > 1)? height : 1);
+    }
+
+    // NOTE: Same pixel format used for all levels, required by ImageResize()
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    tracemap->levels[0] = image;
+    tracemap->levelCount = 1;
+
+    // Generate mipmap levels (halving previous level) until last level fits in one tile
+    while ((tracemap->levelCount < TRACEMAP_MAX_LEVELS) && ((image.width > TRACEMAP_TILE_SIZE) || (image.height > TRACEMAP_TILE_SIZE)))
+    {
+        image = ImageCopy(image);
+        ImageResize(&image, (image.width > 1)? image.width/2 : 1, (image.height > 1)? image.height/2 : 1);
+
+        tracemap->levels[tracemap->levelCount] = image;
+        tracemap->levelCount++;
+    }
+
+    return true;
+}
+
+// Unload tracemap image levels and tiles textures
+static void UnloadTracemap(Tracemap *tracemap)
+{
+    for (int i = 0; i < TRACEMAP_MAX_TILES; i++)
+    {
+        if (tracemap->tiles[i].texture.id > 0) UnloadTexture(tracemap->tiles[i].texture);
+    }
+
+    for (int i = 0; i < tracemap->levelCount; i++) UnloadImage(tracemap->levels[i]);
+
+    if (tracemap->preview.id > 0) UnloadTexture(tracemap->preview);
+
+    memset(tracemap->tiles, 0, sizeof(tracemap->tiles));
+    memset(tracemap->levels, 0, sizeof(tracemap->levels));
+    tracemap->preview = (Texture2D){ 0 };
+    tracemap->levelCount = 0;
+    tracemap->width = 0;
+    tracemap->height = 0;
+    tracemap->loaded = false;
+}
+
+// Draw tracemap visible tiles at level required by current scale
+// NOTE: Selected level is the smallest one providing at least ~1 image pixel per screen pixel,
+// tiles not yet uploaded (upload budget per frame reached) are drawn from the preview texture
+static void DrawTracemap(Tracemap *tracemap, Color tint)
+{
+    if (!tracemap->loaded || (tracemap->rec.width <= 0) || (tracemap->rec.height <= 0)) return;
+
+    tracemap->frameCounter++;
+
+    // Get screen pixels per image pixel (level 0)
+    // NOTE: Level 0 could be smaller than original image size (downscaled on loading)
+    float scaleX = tracemap->rec.width/(float)tracemap->levels[0].width;
+    float scaleY = tracemap->rec.height/(float)tracemap->levels[0].height;
+    float scale = (scaleX > scaleY)? scaleX : scaleY;
+
+    int level = 0;
+    while ((level < (tracemap->levelCount - 1)) && ((scale*(float)(2 << level)) <= 1.5f)) level++;
+
+    // Last level is the preview texture, no tiles required
+    if (level == (tracemap->levelCount - 1))
+    {
+        DrawTexturePro(tracemap->preview, (Rectangle){ 0, 0, (float)tracemap->preview.width, (float)tracemap->preview.height }, tracemap->rec, (Vector2){ 0, 0 }, 0.0f, tint);
+        return;
+    }
+
+    Rectangle visibleRec = GetCollisionRec(tracemap->rec, (Rectangle){ 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() });
+
+    if ((visibleRec.width <= 0) || (visibleRec.height <= 0)) return;
+
+    Image *image = &tracemap->levels[level];
+
+    // Get level pixels per screen pixel
+    float levelScaleX = (float)image->width/tracemap->rec.width;
+    float levelScaleY = (float)image->height/tracemap->rec.height;
+
+    // Get preview pixels per level pixel
+    float previewScaleX = (float)tracemap->preview.width/(float)image->width;
+    float previewScaleY = (float)tracemap->preview.height/(float)image->height;
+
+    // Get visible tiles range in level
+    int firstTileX = (int)((visibleRec.x - tracemap->rec.x)*levelScaleX)/TRACEMAP_TILE_SIZE;
+    int firstTileY = (int)((visibleRec.y - tracemap->rec.y)*levelScaleY)/TRACEMAP_TILE_SIZE;
+    int lastTileX = (int)((visibleRec.x + visibleRec.width - tracemap->rec.x)*levelScaleX)/TRACEMAP_TILE_SIZE;
+    int lastTileY = (int)((visibleRec.y + visibleRec.height - tracemap->rec.y)*levelScaleY)/TRACEMAP_TILE_SIZE;
+
+    if (lastTileX > ((image->width - 1)/TRACEMAP_TILE_SIZE)) lastTileX = (image->width - 1)/TRACEMAP_TILE_SIZE;
+    if (lastTileY > ((image->height - 1)/TRACEMAP_TILE_SIZE)) lastTileY = (image->height - 1)/TRACEMAP_TILE_SIZE;
+
+    int uploadCount = 0;
+
+    for (int y = firstTileY; y <= lastTileY; y++)
+    {
+        for (int x = firstTileX; x <= lastTileX; x++)
+        {
+            Rectangle source = { (float)(x*TRACEMAP_TILE_SIZE), (float)(y*TRACEMAP_TILE_SIZE), 0, 0 };
+            source.width = (float)(((image->width - x*TRACEMAP_TILE_SIZE) < TRACEMAP_TILE_SIZE)? (image->width - x*TRACEMAP_TILE_SIZE) : TRACEMAP_TILE_SIZE);
+            source.height = (float)(((image->height - y*TRACEMAP_TILE_SIZE) < TRACEMAP_TILE_SIZE)? (image->height - y*TRACEMAP_TILE_SIZE) : TRACEMAP_TILE_SIZE);
+
+            Rectangle dest = { tracemap->rec.x + source.x/levelScaleX, tracemap->rec.y + source.y/levelScaleY, source.width/levelScaleX, source.height/levelScaleY };
+
+            // Find tile in cache, looking for the least recently used slot at the same time
+            TracemapTile *tile = NULL;
+            TracemapTile *freeTile = NULL;
+
+            for (int i = 0; i < TRACEMAP_MAX_TILES; i++)
+            {
+                TracemapTile *current = &tracemap->tiles[i];
+
+                if ((current->texture.id > 0) && (current->level == level) && (current->x == x) && (current->y == y))
+                {
+                    tile = current;
+                    break;
+                }
+
+                // NOTE: Tiles already drawn on current frame are never evicted
+                if ((current->lastUsed != tracemap->frameCounter) && ((freeTile == NULL) || (current->texture.id == 0) ||
+                    ((freeTile->texture.id > 0) && (current->lastUsed < freeTile->lastUsed)))) freeTile = current;
+            }
+
+            // Upload tile to GPU if not available (upload budget per frame is limited)
+            if ((tile == NULL) && (freeTile != NULL) && (uploadCount < TRACEMAP_MAX_TILE_UPLOADS))
+            {
+                if (freeTile->texture.id > 0) UnloadTexture(freeTile->texture);
+
+                Image tileImage = ImageFromImage(*image, source);
+                freeTile->texture = LoadTextureFromImage(tileImage);
+                UnloadImage(tileImage);
+
+                SetTextureFilter(freeTile->texture, TEXTURE_FILTER_BILINEAR);
+                freeTile->level = level;
+                freeTile->x = x;
+                freeTile->y = y;
+
+                tile = freeTile;
+                uploadCount++;
+            }
+
+            if (tile != NULL)
+            {
+                tile->lastUsed = tracemap->frameCounter;
+                DrawTexturePro(tile->texture, (Rectangle){ 0, 0, source.width, source.height }, dest, (Vector2){ 0, 0 }, 0.0f, tint);
+            }
+            else
+            {
+                Rectangle previewSource = { source.x*previewScaleX, source.y*previewScaleY, source.width*previewScaleX, source.height*previewScaleY };
+                DrawTexturePro(tracemap->preview, previewSource, dest, (Vector2){ 0, 0 }, 0.0f, tint);
+            }
+        }
+    }
+}
+
+// Load background grid shader
+// NOTE: Grid shader locations are checked, default shader is returned by raylib on compilation failure
+static BackgroundGrid LoadBackgroundGrid(void)
+{
+    BackgroundGrid grid = { 0 };
+
+#if defined(SUPPORT_SHADER_GRID)
+    grid.shader = LoadShaderFromMemory(NULL, gridShaderCode);
+    grid.sizeLoc = GetShaderLocation(grid.shader, "gridSize");
+    grid.spacingLoc = GetShaderLocation(grid.shader, "gridSpacing");
+    grid.subdivisionsLoc = GetShaderLocation(grid.shader, "gridSubdivisions");
+    grid.colorLoc = GetShaderLocation(grid.shader, "gridColor");
+
+    if ((grid.sizeLoc != -1) && (grid.spacingLoc != -1) && (grid.subdivisionsLoc != -1) && (grid.colorLoc != -1))
+    {
+        Image image = GenImageColor(1, 1, WHITE);
+        grid.texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+
+        grid.ready = (grid.texture.id > 0);
+    }
+#endif
+
+    return grid;
+}
+
+// Unload background grid shader
+static void UnloadBackgroundGrid(BackgroundGrid *grid)
+{
+#if defined(SUPPORT_SHADER_GRID)
+    // NOTE: Default shader must not be unloaded, only loaded if shader ready
+    if (grid->ready) UnloadShader(grid->shader);
+    if (grid->texture.id > 0) UnloadTexture(grid->texture);
+#endif
+
+    *grid = (BackgroundGrid){ 0 };
+}
+
+// Draw background grid (single quad if shader ready)
+// NOTE: Spacing is the subdivision spacing in pixels, major lines every subdivisions
+static void DrawBackgroundGrid(BackgroundGrid *grid, Rectangle bounds, int spacing, int subdivisions)
+{
+    if (!grid->ready)
+    {
+        GuiGrid(bounds, NULL, (float)(spacing*subdivisions), subdivisions, NULL);
+        return;
+    }
+
+    // NOTE: GuiGrid() only draws grid on normal state
+    if ((GuiGetState() != STATE_NORMAL) || (spacing <= 0) || (subdivisions <= 0)) return;
+
+    Vector2 size = { bounds.width, bounds.height };
+    float gridSpacing = (float)spacing;
+    float gridSubdivisions = (float)subdivisions;
+    Vector4 color = ColorNormalize(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
+
+    SetShaderValue(grid->shader, grid->sizeLoc, &size, SHADER_UNIFORM_VEC2);
+    SetShaderValue(grid->shader, grid->spacingLoc, &gridSpacing, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(grid->shader, grid->subdivisionsLoc, &gridSubdivisions, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(grid->shader, grid->colorLoc, &color, SHADER_UNIFORM_VEC4);
+
+    BeginShaderMode(grid->shader);
+        DrawTexturePro(grid->texture, (Rectangle){ 0, 0, 1, 1 }, bounds, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    EndShaderMode();
+}
+
+//--------------------------------------------------------------------------------------------
+// File jobs callbacks
+//--------------------------------------------------------------------------------------------
+
+// Load layout file
+static void ProcessLoadLayoutJob(FileJob *job)
+{
+    job->data = LoadLayout(job->fileName);
+    job->result = (job->data != NULL);
+}
+
+// Replace editor layout with loaded one
+static void CompleteLoadLayoutJob(FileJob *job)
+{
+    EditorState *editor = (EditorState *)job->userData;
+    GuiLayout *tempLayout = (GuiLayout *)job->data;
+
+    if (tempLayout != NULL)
+    {
+        memcpy(editor->layout, tempLayout, sizeof(GuiLayout));
+
+        // WARNING: When layout is loaded, anchor object references are not set, they must be reset manually
+        for (int i = 0; i < editor->layout->controlCount; i++) editor->layout->controls[i].ap = &editor->layout->anchors[tempLayout->controls[i].ap->id];
+
+        // Reinit undo levels for new layout
+        ResetUndoLayouts(editor->undoLayouts, editor->currentUndoIndex, editor->firstUndoIndex, editor->lastUndoIndex, editor->layout);
+
+        ClearSelection(editor->selection);
+        UnloadLayout(tempLayout);
+
+        strcpy(inFileName, job->fileName);
+        SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
+        saveChangesRequired = false;
+    }
+    else LOG("WARNING: [%s] Layout file could not be loaded\n", job->fileName);
+}
+
+// Save layout copy as text file
+static void ProcessSaveLayoutJob(FileJob *job)
+{
+    job->result = SaveLayout((GuiLayout *)job->data, job->fileName);
+}
+
+// Save text (code) file
+static void ProcessSaveTextJob(FileJob *job)
+{
+    FILE *file = fopen(job->fileName, "wt");
+
+    if (file != NULL)
+    {
+        job->result = (fputs((const char *)job->data, file) >= 0);
+        fclose(file);
+    }
+}
+
+// Check saving result and free saved data
+static void CompleteSaveJob(FileJob *job)
+{
+    if (!job->result)
+    {
+        LOG("WARNING: [%s] File could not be saved\n", job->fileName);
+
+        // Layout changes were not saved, restore the '*' mark on file name (if still the editing file)
+        if (IsFileExtension(job->fileName, ".rgl") && (strcmp(job->fileName, inFileName) == 0))
+        {
+            SetWindowTitle(TextFormat("%s v%s - %s*", toolName, toolVersion, GetFileName(inFileName)));
+            saveChangesRequired = true;
+        }
+    }
+#if defined(PLATFORM_WEB)
+    // Download file from MEMFS (emscripten memory filesystem)
+    // NOTE: Second argument must be a simple filename (we can't use directories)
+    // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
+    else if (strchr(job->fileName, '\'') == NULL) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", job->fileName, GetFileName(job->fileName)));
+#endif
+
+    RL_FREE(job->data);
+}
+
+// Load tracemap image levels
+static void ProcessLoadTracemapJob(FileJob *job)
+{
+    TracemapJobData *jobData = (TracemapJobData *)job->data;
+
+    job->result = LoadTracemapLevels(&jobData->tracemap, job->fileName);
+}
+
+// Replace editor tracemap with loaded one
+// NOTE: Image levels ownership is moved to editor tracemap, only the preview level is uploaded to GPU
+static void CompleteLoadTracemapJob(FileJob *job)
+{
+    EditorState *editor = (EditorState *)job->userData;
+    TracemapJobData *jobData = (TracemapJobData *)job->data;
+
+    if (job->result)
+    {
+        Tracemap *tracemap = editor->tracemap;
+
+        UnloadTracemap(tracemap);
+
+        memcpy(tracemap->levels, jobData->tracemap.levels, sizeof(tracemap->levels));
+        tracemap->levelCount = jobData->tracemap.levelCount;
+        tracemap->width = jobData->tracemap.width;
+        tracemap->height = jobData->tracemap.height;
+
+        tracemap->preview = LoadTextureFromImage(tracemap->levels[tracemap->levelCount - 1]);
+        SetTextureFilter(tracemap->preview, TEXTURE_FILTER_BILINEAR);
+        tracemap->loaded = true;
+
+        tracemap->rec = (Rectangle){ jobData->position.x - tracemap->width*jobData->pivot.x, jobData->position.y - tracemap->height*jobData->pivot.y, tracemap->width, tracemap->height };
+        tracemap->visible = true;
+        tracemap->alpha = 0.7f;
+
+        *editor->tracemapLoaded = true;
+    }
+    else
+    {
+        LOG("WARNING: [%s] Tracemap image could not be loaded\n", job->fileName);
+
+        // NOTE: Tracemap file name must not be kept as layout file name (avoid overwriting image on saving)
+        if (strcmp(inFileName, job->fileName) == 0) inFileName[0] = '\0';
+    }
+
+    RL_FREE(jobData);
+}
+
+// Delete selected controls
+// NOTE: Layout controls are compacted in a single pass, keeping controls order
+static void DeleteSelectedControls(GuiLayout *layout, GuiLayoutSelection *selection)
+{
+    if (selection->count == 0) return;
+
+    int count = 0;
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        if (IsControlSelected(selection, i)) continue;
+
+        if (count != i) layout->controls[count] = layout->controls[i];
+        layout->controls[count].id = count;
+        count++;
+    }
+
+    // Clear removed controls slots
+    for (int i = count; i < layout->controlCount; i++)
+    {
+        memset(&layout->controls[i], 0, sizeof(GuiLayoutControl));
+        layout->controls[i].ap = &layout->anchors[0];
+    }
+
+    layout->controlCount = count;
+
+    ClearSelection(selection);
+}
+
+//--------------------------------------------------------------------------------------------
+// Smart guides functions
+//--------------------------------------------------------------------------------------------
+
+// Compare smart guides edges by position, required by qsort()
+static int CompareGuideEdges(const void *a, const void *b)
+{
+    float posA = ((const GuideEdge *)a)->position;
+    float posB = ((const GuideEdge *)b)->position;
+
+    return (posA > posB) - (posA < posB);
+}
+
+// Find nearest guide edge to position, binary search on edges sorted by position
+// NOTE: Returns -1 if there is no edge in snap distance
+static int FindNearestGuideEdge(const GuideEdge *edges, int count, float position, float snapDistance)
+{
+    // Get first edge with position >= requested position
+    int low = 0;
+    int high = count;
+
+    while (low < high)
+    {
+        int mid = low + (high - low)/2;
+
+        if (edges[mid].position < position) low = mid + 1;
+        else high = mid;
+    }
+
+    // Nearest edge is the found one or the previous one
+    int nearest = -1;
+
+    if ((low < count) && ((edges[low].position - position) <= snapDistance)) nearest = low;
+
+    if ((low > 0) && ((position - edges[low - 1].position) <= snapDistance) &&
+        ((nearest == -1) || ((position - edges[low - 1].position) < (edges[nearest].position - position)))) nearest = low - 1;
+
+    return nearest;
+}
+
+// Build sorted edges of not selected controls and anchors
+// NOTE: Selected controls are moved/scaled together, they are not snapping targets
+static void BuildSmartGuides(SmartGuides *guides, const GuiLayout *layout, const GuiLayoutSelection *selection)
+{
+    int countX = 0;
+    int countY = 0;
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        if (IsControlSelected(selection, i) || layout->controls[i].ap->hidding) continue;
+
+        Rectangle rec = GetControlScreenRec(&layout->controls[i]);
+
+        // Vertical edges: left, center, right
+        guides->edgesX[countX++] = (GuideEdge){ rec.x, rec.y, rec.y + rec.height };
+        guides->edgesX[countX++] = (GuideEdge){ rec.x + rec.width/2, rec.y, rec.y + rec.height };
+        guides->edgesX[countX++] = (GuideEdge){ rec.x + rec.width, rec.y, rec.y + rec.height };
+
+        // Horizontal edges: top, center, bottom
+        guides->edgesY[countY++] = (GuideEdge){ rec.y, rec.x, rec.x + rec.width };
+        guides->edgesY[countY++] = (GuideEdge){ rec.y + rec.height/2, rec.x, rec.x + rec.width };
+        guides->edgesY[countY++] = (GuideEdge){ rec.y + rec.height, rec.x, rec.x + rec.width };
+    }
+
+    // Anchors positions, reference window anchor (anchor[0]) included
+    for (int i = 0; i < MAX_ANCHOR_POINTS; i++)
+    {
+        if (!layout->anchors[i].enabled) continue;
+
+        guides->edgesX[countX++] = (GuideEdge){ (float)layout->anchors[i].x, (float)layout->anchors[i].y, (float)layout->anchors[i].y };
+        guides->edgesY[countY++] = (GuideEdge){ (float)layout->anchors[i].y, (float)layout->anchors[i].x, (float)layout->anchors[i].x };
+    }
+
+    qsort(guides->edgesX, countX, sizeof(GuideEdge), CompareGuideEdges);
+    qsort(guides->edgesY, countY, sizeof(GuideEdge), CompareGuideEdges);
+
+    guides->edgeCountX = countX;
+    guides->edgeCountY = countY;
+    guides->ready = true;
+}
+
+// Get offset to snap rectangle edges to nearest guides
+// NOTE: Moved rectangles snap any edge or center, resized ones (resize = true) only right/bottom edges
+static Vector2 GetSmartGuidesSnap(SmartGuides *guides, Rectangle rec, bool resize)
+{
+    Vector2 offset = { 0 };
+
+    // NOTE: Right/bottom edges first, only ones checked on resize
+    float positionsX[3] = { rec.x + rec.width, rec.x + rec.width/2, rec.x };
+    float positionsY[3] = { rec.y + rec.height, rec.y + rec.height/2, rec.y };
+    int positionsCount = resize? 1 : 3;
+
+    guides->snappedX = false;
+    guides->snappedY = false;
+
+    for (int i = 0; i < positionsCount; i++)
+    {
+        int index = FindNearestGuideEdge(guides->edgesX, guides->edgeCountX, positionsX[i], SMART_GUIDES_SNAP_DISTANCE);
+
+        if (index != -1)
+        {
+            float delta = guides->edgesX[index].position - positionsX[i];
+
+            if (!guides->snappedX || (fabsf(delta) < fabsf(offset.x)))
+            {
+                offset.x = delta;
+                guides->guideX = guides->edgesX[index];
+                guides->snappedX = true;
+            }
+        }
+
+        index = FindNearestGuideEdge(guides->edgesY, guides->edgeCountY, positionsY[i], SMART_GUIDES_SNAP_DISTANCE);
+
+        if (index != -1)
+        {
+            float delta = guides->edgesY[index].position - positionsY[i];
+
+            if (!guides->snappedY || (fabsf(delta) < fabsf(offset.y)))
+            {
+                offset.y = delta;
+                guides->guideY = guides->edgesY[index];
+                guides->snappedY = true;
+            }
+        }
+    }
+
+    // Extend guides lines to cover the snapped rectangle
+    if (resize)
+    {
+        rec.width += offset.x;
+        rec.height += offset.y;
+    }
+    else
+    {
+        rec.x += offset.x;
+        rec.y += offset.y;
+    }
+
+    if (guides->snappedX)
+    {
+        if (rec.y < guides->guideX.min) guides->guideX.min = rec.y;
+        if ((rec.y + rec.height) > guides->guideX.max) guides->guideX.max = rec.y + rec.height;
+    }
+
+    if (guides->snappedY)
+    {
+        if (rec.x < guides->guideY.min) guides->guideY.min = rec.x;
+        if ((rec.x + rec.width) > guides->guideY.max) guides->guideY.max = rec.x + rec.width;
+    }
+
+    return offset;
+}
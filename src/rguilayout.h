@@ -111,6 +111,15 @@ typedef struct {
     Rectangle refWindow;
 } GuiLayout;
 
+// Gui layout controls selection type
+// NOTE: Bitset provides O(1) membership check, dense list provides O(k) iteration over selected controls
+typedef struct {
+    unsigned int bits[(MAX_GUI_CONTROLS + 31)/32];  // Selected control slots bitset
+    int indices[MAX_GUI_CONTROLS];                  // Selected control slots (dense list)
+    int position[MAX_GUI_CONTROLS];                 // Position of every selected slot in dense list
+    int count;                                      // Number of selected control slots
+} GuiLayoutSelection;
+
 // Gui layout configuration for code exportation
 typedef struct {
     unsigned char name[64];